@@ -0,0 +1,62 @@
+#ifndef CPPGEOMETRY_BENCH_HPP
+#define CPPGEOMETRY_BENCH_HPP
+
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string_view>
+#include <vector>
+
+#include "../inc/math/Point.hpp"
+
+namespace geom::bench {
+    // Best of `repeats` wall-clock runs in milliseconds
+    template <class F>
+    double TimeMs(F&& f, const int repeats = 5) {
+        double best = std::numeric_limits<double>::max();
+        for (int i = 0; i < repeats; i++) {
+            const auto start = std::chrono::steady_clock::now();
+            f();
+            const auto end = std::chrono::steady_clock::now();
+            best = std::min(best, std::chrono::duration<double, std::milli>(end - start).count());
+        }
+        return best;
+    }
+
+    inline void Report(const std::string_view name, const size_t n, const double ms) {
+        std::cout << std::left << std::setw(40) << name
+                  << std::right << std::setw(12) << n << " pts"
+                  << std::setw(12) << std::fixed << std::setprecision(3) << ms << " ms"
+                  << std::setw(12) << std::setprecision(1) << n / ms / 1e3 << " Mpts/s\n";
+    }
+
+    inline std::vector<math::Point2f> UniformPoints(const size_t n, const unsigned seed = 42) {
+        std::mt19937 rng(seed);
+        std::uniform_real_distribution<float> dist(0.0, 1.0);
+        std::vector<math::Point2f> points;
+        points.reserve(n);
+        for (size_t i = 0; i < n; i++) points.emplace_back(dist(rng), dist(rng));
+        return points;
+    }
+
+    // Gaussian blobs around a handful of random centres
+    inline std::vector<math::Point2f> ClusteredPoints(const size_t n, const size_t clusters = 16, const unsigned seed = 42) {
+        std::mt19937 rng(seed);
+        std::uniform_real_distribution<float> centre(0.1, 0.9);
+        std::normal_distribution<float> spread(0.0, 0.01);
+        std::vector<math::Point2f> centres;
+        for (size_t i = 0; i < clusters; i++) centres.emplace_back(centre(rng), centre(rng));
+
+        std::vector<math::Point2f> points;
+        points.reserve(n);
+        for (size_t i = 0; i < n; i++) {
+            const auto& c = centres[i % clusters];
+            points.emplace_back(c.x() + spread(rng), c.y() + spread(rng));
+        }
+        return points;
+    }
+} // namespace geom::bench
+
+#endif // CPPGEOMETRY_BENCH_HPP
@@ -0,0 +1,30 @@
+#include "Bench.hpp"
+#include "../inc/alg/ApproximateHull.hpp"
+#include "../inc/alg/ConvexHull.hpp"
+
+using namespace geom;
+
+// Keeps results observable so the sketches are not optimised away
+volatile size_t sink;
+
+void Run(const std::string_view distribution, const std::vector<math::Point2f>& points) {
+    std::cout << "-- " << distribution << "\n";
+    bench::Report("ConvexHull2D exact", points.size(), bench::TimeMs([&] { sink = alg::ConvexHull2D(points).size(); }, 3));
+    for (const float epsilon : {0.05f, 0.01f, 0.001f}) {
+        const std::string name = "HullSketch eps=" + std::to_string(epsilon).substr(0, 5)
+                                 + " k=" + std::to_string(alg::HullSketch::DirectionsFor(epsilon));
+        bench::Report(name, points.size(), bench::TimeMs([&] {
+            alg::HullSketch sketch(epsilon);
+            for (const auto& p : points) sketch.Add(p);
+            sink = sketch.Hull().size();
+        }, 3));
+    }
+    bench::Report("HullSketch eps=0.01 par", points.size(),
+                  bench::TimeMs([&] { sink = alg::ApproximateHull(exec::par, points, 0.01).Hull().size(); }, 3));
+}
+
+int main() {
+    constexpr size_t kPoints = 10000000;
+    Run("uniform", bench::UniformPoints(kPoints));
+    Run("clustered", bench::ClusteredPoints(kPoints));
+}
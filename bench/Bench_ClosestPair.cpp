@@ -0,0 +1,48 @@
+#include "Bench.hpp"
+#include "../inc/alg/ClosestPair.hpp"
+
+using namespace geom;
+
+// Keeps results observable so the timed calls are not optimised away
+volatile float sink;
+
+float BruteForceClosest(const std::vector<math::Point2f>& points) {
+    float best = std::numeric_limits<float>::max();
+    for (size_t i = 0; i < points.size(); i++)
+        for (size_t j = i + 1; j < points.size(); j++) best = std::min(best, math::SquaredDistance(points[i], points[j]));
+    return best;
+}
+
+std::vector<size_t> BruteForceNeighbours(const std::vector<math::Point2f>& points) {
+    std::vector<size_t> neighbours(points.size());
+    for (size_t i = 0; i < points.size(); i++) {
+        float best = std::numeric_limits<float>::max();
+        for (size_t j = 0; j < points.size(); j++) {
+            if (const float d = math::SquaredDistance(points[i], points[j]); j != i && d < best) {
+                best = d;
+                neighbours[i] = j;
+            }
+        }
+    }
+    return neighbours;
+}
+
+void Run(const std::string_view distribution, const std::vector<math::Point2f>& small, const std::vector<math::Point2f>& large) {
+    std::cout << "-- " << distribution << "\n";
+    bench::Report("ClosestPair brute force", small.size(), bench::TimeMs([&] { sink = BruteForceClosest(small); }, 1));
+    bench::Report("ClosestPair seq", small.size(), bench::TimeMs([&] { sink = alg::ClosestPair(small).distance; }));
+    bench::Report("ClosestPair seq", large.size(), bench::TimeMs([&] { sink = alg::ClosestPair(large).distance; }, 3));
+    bench::Report("ClosestPair par", large.size(), bench::TimeMs([&] { sink = alg::ClosestPair(exec::par, large).distance; }, 3));
+
+    bench::Report("AllNearestNeighbours brute force", small.size(), bench::TimeMs([&] { sink = BruteForceNeighbours(small)[0]; }, 1));
+    bench::Report("AllNearestNeighbours seq", small.size(), bench::TimeMs([&] { sink = alg::AllNearestNeighbours(small)[0]; }));
+    bench::Report("AllNearestNeighbours seq", large.size(), bench::TimeMs([&] { sink = alg::AllNearestNeighbours(large)[0]; }, 3));
+    bench::Report("AllNearestNeighbours par", large.size(), bench::TimeMs([&] { sink = alg::AllNearestNeighbours(exec::par, large)[0]; }, 3));
+}
+
+int main() {
+    constexpr size_t kSmall = 20000;
+    constexpr size_t kLarge = 4000000;
+    Run("uniform", bench::UniformPoints(kSmall), bench::UniformPoints(kLarge));
+    Run("clustered", bench::ClusteredPoints(kSmall), bench::ClusteredPoints(kLarge));
+}
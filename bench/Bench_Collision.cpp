@@ -0,0 +1,72 @@
+#include "Bench.hpp"
+#include "../inc/alg/Collision.hpp"
+#include "../inc/alg/ConvexHull.hpp"
+
+using namespace geom;
+
+// Keeps results observable so the queries are not optimised away
+volatile size_t sink;
+
+// Hulls of 32-point clouds of radius ~`size` scattered uniformly over the unit square
+std::vector<std::vector<math::Point2f>> Hulls(const size_t n, const float size) {
+    const auto centres = bench::UniformPoints(n);
+    const auto offsets = bench::UniformPoints(32 * n, 7);
+    std::vector<std::vector<math::Point2f>> hulls;
+    hulls.reserve(n);
+    for (size_t i = 0; i < n; i++) {
+        std::vector<math::Point2f> cloud;
+        for (size_t k = 0; k < 32; k++) {
+            const auto& o = offsets[32 * i + k];
+            cloud.push_back(centres[i] + math::Vector2f {o.x() - 0.5f, o.y() - 0.5f} * (2 * size));
+        }
+        hulls.push_back(alg::ConvexHull2D(cloud));
+    }
+    return hulls;
+}
+
+int main() {
+    const auto pairs = Hulls(2000, 0.1);
+    bench::Report("MinkowskiSum", pairs.size(), bench::TimeMs([&] {
+        size_t total = 0;
+        for (size_t i = 0; i + 1 < pairs.size(); i++) total += alg::MinkowskiSum(pairs[i], pairs[i + 1]).size();
+        sink = total;
+    }));
+    bench::Report("MinkowskiSum by hull of pairwise sums", pairs.size(), bench::TimeMs([&] {
+        size_t total = 0;
+        for (size_t i = 0; i + 1 < pairs.size(); i++) {
+            std::vector<math::Point2f> sums;
+            for (const auto& p : pairs[i]) {
+                for (const auto& q : pairs[i + 1]) sums.push_back(p + q);
+            }
+            total += alg::ConvexHull2D(sums).size();
+        }
+        sink = total;
+    }));
+    bench::Report("ConvexDistance", pairs.size(), bench::TimeMs([&] {
+        size_t overlaps = 0;
+        for (size_t i = 0; i + 1 < pairs.size(); i++) overlaps += alg::ConvexDistance(pairs[i], pairs[i + 1]).overlap;
+        sink = overlaps;
+    }));
+    bench::Report("PenetrationDepth", pairs.size(), bench::TimeMs([&] {
+        size_t overlaps = 0;
+        for (size_t i = 0; i + 1 < pairs.size(); i++) overlaps += alg::PenetrationDepth(pairs[i], pairs[i + 1]).has_value();
+        sink = overlaps;
+    }));
+
+    // One tick of a scene where every hull touches a few neighbours; the count is hulls, not pairs
+    for (const size_t n : {1000, 10000, 100000}) {
+        const auto hulls = Hulls(n, 0.5f / std::sqrt(static_cast<float>(n)));
+        std::cout << "-- " << n << " hulls, " << alg::FindContacts(exec::par, hulls).size() << " contacts\n";
+        if (n <= 1000) {
+            bench::Report("all pairs ConvexDistance", n, bench::TimeMs([&] {
+                size_t overlaps = 0;
+                for (size_t i = 0; i < n; i++) {
+                    for (size_t j = i + 1; j < n; j++) overlaps += alg::ConvexDistance(hulls[i], hulls[j]).overlap;
+                }
+                sink = overlaps;
+            }, 1));
+        }
+        bench::Report("FindContacts seq", n, bench::TimeMs([&] { sink = alg::FindContacts(hulls).size(); }, 3));
+        bench::Report("FindContacts par", n, bench::TimeMs([&] { sink = alg::FindContacts(exec::par, hulls).size(); }, 3));
+    }
+}
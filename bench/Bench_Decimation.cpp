@@ -0,0 +1,29 @@
+#include "Bench.hpp"
+#include "../inc/viz/Decimation.hpp"
+
+using namespace geom;
+
+// Keeps results observable so the cell walk is not optimised away
+volatile float sink;
+
+// Per-frame cost with and without decimation on the Renderer's 640x640 canvas. Without it every
+// point is a draw; with it only the occupied pixels are, however many points there are.
+int main() {
+    constexpr size_t kSize = 640;
+    for (const size_t n : {100000, 1000000, 10000000}) {
+        auto points = bench::ClusteredPoints(n);
+        for (auto& p : points) p = p * static_cast<float>(kSize);
+
+        viz::ScreenDecimator lod(kSize, kSize);
+        bench::Report("ScreenDecimator Add", n, bench::TimeMs([&] {
+            lod.Clear();
+            lod.Add(points);
+        }));
+        const double frame = bench::TimeMs([&] {
+            float checksum = 0;
+            lod.ForEachCell([&checksum](const math::Point2f& p, const uint32_t count) { checksum += p.x() + count; });
+            sink = checksum;
+        });
+        std::cout << "  per frame: " << lod.Cells() << " vertices instead of " << n << ", rebuilt in " << std::setprecision(3) << frame << " ms\n";
+    }
+}
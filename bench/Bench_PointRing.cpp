@@ -0,0 +1,46 @@
+#include <thread>
+
+#include "Bench.hpp"
+#include "../inc/alg/ConvexHull.hpp"
+#include "../inc/ipc/PointRing.hpp"
+
+using namespace geom;
+
+// Keeps results observable so the consumers are not optimised away
+volatile size_t sink;
+
+// Streams `points` through a fresh ring from a producer thread and hands each span to `consume`
+template <class F>
+void Stream(const std::vector<math::Point2f>& points, const size_t capacity, const size_t batch, F&& consume) {
+    const std::string name = "/cppgeometry_bench_" + std::to_string(getpid());
+    auto ring = ipc::PointRing::Create(name, capacity);
+    std::thread producer([&] {
+        auto ring = ipc::PointRing::Open(name);
+        ipc::Produce(ring, points.size(), batch, [&points](const std::span<math::Point2f> slots, const size_t first) {
+            std::copy_n(points.begin() + first, slots.size(), slots.begin());
+        });
+    });
+    const bool finished = ipc::Drain(ring, consume, std::chrono::seconds(10));
+    producer.join();
+    if (!finished) throw std::runtime_error("Producer stalled");
+}
+
+int main() {
+    constexpr size_t kPoints = 20000000;
+    const auto points = bench::ClusteredPoints(kPoints);
+
+    for (const size_t batch : {64, 1024, 16384}) {
+        bench::Report("PointRing batch=" + std::to_string(batch), kPoints, bench::TimeMs([&] {
+            size_t count = 0;
+            Stream(points, 1 << 16, batch, [&count](const std::span<const math::Point2f> span) { count += span.size(); });
+            sink = count;
+        }, 3));
+    }
+
+    bench::Report("PointRing + IncrementalHull", kPoints, bench::TimeMs([&] {
+        alg::IncrementalHull hull;
+        Stream(points, 1 << 16, 4096, [&hull](const std::span<const math::Point2f> span) { hull.Add(span); });
+        sink = hull.Hull().size();
+    }, 3));
+    bench::Report("ConvexHull2D of the whole input", kPoints, bench::TimeMs([&] { sink = alg::ConvexHull2D(points).size(); }, 3));
+}
@@ -0,0 +1,48 @@
+#include "Bench.hpp"
+#include "../inc/alg/ConvexHull.hpp"
+#include "../inc/alg/SegmentIntersection.hpp"
+#include "../inc/math/Line.hpp"
+
+using namespace geom;
+
+// Keeps results observable so the loops are not optimised away
+volatile size_t sink;
+
+// Eval is the predicate type, void for the storage type's own
+template <class Eval, class T>
+void Run(const std::string_view name, const std::vector<math::Vector<T, math::DIM2>>& points) {
+    std::cout << "-- " << name << ": " << sizeof(math::Vector<T, math::DIM2>) << " B/point, "
+              << points.size() * sizeof(math::Vector<T, math::DIM2>) / (1 << 20) << " MiB\n";
+    bench::Report("Orientation2d", points.size(), bench::TimeMs([&] {
+        size_t positive = 0;
+        for (size_t i = 0; i + 2 < points.size(); i++) {
+            positive += math::Orientation2d<Eval>(points[i], points[i + 1], points[i + 2]) == math::Orientation::POSITIVE;
+        }
+        sink = positive;
+    }));
+    bench::Report("ConvexHull2D", points.size(), bench::TimeMs([&] { sink = alg::ConvexHull2D<Eval>(points).size(); }, 3));
+    bench::Report("ConvexHull2D par", points.size(),
+                  bench::TimeMs([&] { sink = alg::ConvexHull2D<Eval>(exec::par, points).size(); }, 3));
+
+    std::vector<math::Line<T, 2>> lines;
+    for (size_t i = 0; i + 1 < points.size() && lines.size() < 200000; i += 2) {
+        // Short segments, so the sweep has a realistic number of crossings to report
+        const auto& p = points[i];
+        const auto d = points[i + 1] - p;
+        const math::Vector<T, math::DIM2> q {static_cast<T>(p.x() + d.x() / 200), static_cast<T>(p.y() + d.y() / 200)};
+        if (p != q) lines.emplace_back(p, q);
+    }
+    bench::Report("SegmentIntersections", lines.size(), bench::TimeMs([&] { sink = alg::SegmentIntersections<Eval>(lines).size(); }, 3));
+}
+
+int main() {
+    constexpr size_t kPoints = 1 << 22;
+    const auto points = bench::UniformPoints(kPoints);
+    std::vector<math::Point2d> points_d;
+    points_d.reserve(points.size());
+    for (const auto& p : points) points_d.emplace_back(p.x(), p.y());
+
+    Run<void>("float", points);
+    Run<double>("mixed: float storage, double predicates", points);
+    Run<void>("double", points_d);
+}
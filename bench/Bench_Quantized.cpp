@@ -0,0 +1,71 @@
+#include "Bench.hpp"
+#include "../inc/alg/ConvexHull.hpp"
+#include "../inc/math/Line.hpp"
+#include "../inc/math/Quantize.hpp"
+
+using namespace geom;
+
+// Keeps results observable so the predicate loops are not optimised away
+volatile size_t sink;
+
+template <class T>
+void RunOrientation(const std::string_view name, const std::vector<math::Vector<T, math::DIM2>>& points) {
+    size_t positive = 0;
+    const double ms = bench::TimeMs([&] {
+        positive = 0;
+        for (size_t i = 0; i + 2 < points.size(); i++) {
+            positive += math::Orientation2d(points[i], points[i + 1], points[i + 2]) == math::Orientation::POSITIVE;
+        }
+        sink = positive;
+    });
+    bench::Report(name, points.size(), ms);
+}
+
+template <class T>
+void RunHull(const std::string_view name, const std::vector<math::Vector<T, math::DIM2>>& points) {
+    const double ms = bench::TimeMs([&] { sink = alg::ConvexHull2D(points).size(); });
+    bench::Report(name, points.size(), ms);
+}
+
+template <class T>
+void RunIntersects(const std::string_view name, const std::vector<math::Vector<T, math::DIM2>>& points) {
+    std::vector<math::Line<T, 2>> lines;
+    for (size_t i = 0; i + 1 < points.size(); i += 2) {
+        if (points[i] != points[i + 1]) lines.emplace_back(points[i], points[i + 1]);
+    }
+    size_t hits = 0;
+    const double ms = bench::TimeMs([&] {
+        hits = 0;
+        for (size_t i = 0; i + 1 < lines.size(); i++) hits += lines[i].Intersects(lines[i + 1]);
+        sink = hits;
+    });
+    bench::Report(name, lines.size(), ms);
+}
+
+int main() {
+    // Grid-snapped input, as produced by our survey datasets
+    auto points = bench::UniformPoints(1 << 20);
+    for (auto& p : points) p = {std::round(p.x() * 4096) / 4096, std::round(p.y() * 4096) / 4096};
+
+    const math::Quantizer<int32_t> quantizer32(points);
+    const math::Quantizer<int16_t> quantizer16(points);
+    const auto points32 = quantizer32.Quantize(points);
+    const auto points16 = quantizer16.Quantize(points);
+
+    std::cout << "Storage: float " << sizeof(math::Point2f) << " B, int32 " << sizeof(math::Point2i)
+              << " B, int16 " << sizeof(math::Point2s) << " B per point\n";
+
+    bench::Report("Quantize<int32>", points.size(), bench::TimeMs([&] { sink = quantizer32.Quantize(points).size(); }));
+
+    RunOrientation("Orientation2d<float>", points);
+    RunOrientation("Orientation2d<int32>", points32);
+    RunOrientation("Orientation2d<int16>", points16);
+
+    RunHull("ConvexHull2D<float>", points);
+    RunHull("ConvexHull2D<int32>", points32);
+    RunHull("ConvexHull2D<int16>", points16);
+
+    RunIntersects("Line::Intersects<float>", points);
+    RunIntersects("Line::Intersects<int32>", points32);
+    RunIntersects("Line::Intersects<int16>", points16);
+}
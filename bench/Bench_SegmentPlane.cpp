@@ -0,0 +1,51 @@
+#include "Bench.hpp"
+#include "../inc/alg/SegmentPlane.hpp"
+
+using namespace geom;
+
+// Keeps results observable so the scalar loop is not optimised away
+volatile size_t sink;
+
+std::vector<math::Line<float, 3>> RandomSegments(const size_t n, const unsigned seed = 42) {
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<float> dist(0.0, 1.0);
+    std::vector<math::Line<float, 3>> lines;
+    lines.reserve(n);
+    for (size_t i = 0; i < n; i++) {
+        lines.emplace_back(math::Point3f {dist(rng), dist(rng), dist(rng)}, math::Point3f {dist(rng), dist(rng), dist(rng)});
+    }
+    return lines;
+}
+
+int main() {
+    constexpr size_t kSegments = 10000000;
+    const auto lines = RandomSegments(kSegments);
+    const alg::SegmentBatch batch(lines);
+    const math::Plane plane(math::Vector3f {0.0, 0.0, 1.0}, 0.5);
+
+    // Scalar baseline producing the same outputs from the array of Lines
+    std::vector<math::Point3f> points(kSegments);
+    std::vector<float> ts(kSegments);
+    std::vector<uint8_t> mask(kSegments);
+    bench::Report("IntersectPlane per Line", kSegments, bench::TimeMs([&] {
+        for (size_t i = 0; i < kSegments; i++) {
+            const auto t = alg::IntersectPlane(lines[i], plane);
+            mask[i] = t.has_value();
+            ts[i] = t.value_or(0);
+            points[i] = lines[i].GetOrigin() + lines[i].GetDir() * ts[i];
+        }
+        sink = mask[kSegments / 2];
+    }, 3));
+
+    alg::PlaneHits hits;
+    bench::Report("IntersectPlane SoA seq", kSegments, bench::TimeMs([&] { alg::IntersectPlaneInto(exec::seq, batch, plane, hits); }, 3));
+    bench::Report("IntersectPlane SoA par", kSegments, bench::TimeMs([&] { alg::IntersectPlaneInto(exec::par, batch, plane, hits); }, 3));
+
+    std::vector<math::Plane> layers;
+    for (int i = 1; i <= 8; i++) layers.emplace_back(math::Vector3f {0.0, 0.0, 1.0}, i / 9.0f);
+    std::vector<alg::PlaneHits> layer_hits;
+    bench::Report("IntersectPlanes 8 layers seq", kSegments * layers.size(),
+                  bench::TimeMs([&] { alg::IntersectPlanesInto(exec::seq, batch, layers, layer_hits); }, 3));
+    bench::Report("IntersectPlanes 8 layers par", kSegments * layers.size(),
+                  bench::TimeMs([&] { alg::IntersectPlanesInto(exec::par, batch, layers, layer_hits); }, 3));
+}
@@ -0,0 +1,69 @@
+#include <cmath>
+#include <numbers>
+
+#include "Bench.hpp"
+#include "../inc/alg/Triangulation.hpp"
+
+using namespace geom;
+
+// Keeps results observable so the ear clipping loop is not optimised away
+volatile size_t sink;
+
+// Jagged outline in the style of a building footprint: a circle with random radial notches
+alg::Polygon Outline(const size_t n, const unsigned seed = 42) {
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<float> notch(0.8, 1.0);
+    alg::Polygon polygon;
+    polygon.reserve(n);
+    for (size_t i = 0; i < n; i++) {
+        const float angle = 2 * std::numbers::pi_v<float> * i / n;
+        const float r = i % 2 ? notch(rng) : 1.0f;
+        polygon.emplace_back(r * std::cos(angle), r * std::sin(angle));
+    }
+    return polygon;
+}
+
+// Quadratic baseline: cut off convex vertices whose triangle holds no other vertex, resuming the
+// scan where the last ear was found
+size_t EarClipping(alg::Polygon polygon) {
+    size_t triangles = 0, start = 0;
+    for (bool clipped = true; clipped && polygon.size() > 3;) {
+        const size_t n = polygon.size();
+        clipped = false;
+        for (size_t k = 0; k < n && !clipped; k++) {
+            const size_t i = (start + k) % n;
+            const auto& a = polygon[(i + n - 1) % n];
+            const auto& b = polygon[i];
+            const auto& c = polygon[(i + 1) % n];
+            if (math::Orientation2d(a, b, c) != math::Orientation::POSITIVE) continue;
+            bool ear = true;
+            for (size_t j = 0; j < n && ear; j++) {
+                const auto& p = polygon[j];
+                if (j == i || j == (i + 1) % n || j == (i + n - 1) % n) continue;
+                ear = !(math::Orientation2d(a, b, p) == math::Orientation::POSITIVE
+                        && math::Orientation2d(b, c, p) == math::Orientation::POSITIVE
+                        && math::Orientation2d(c, a, p) == math::Orientation::POSITIVE);
+            }
+            if (!ear) continue;
+            polygon.erase(polygon.begin() + i);
+            triangles++;
+            start = i;
+            clipped = true;
+        }
+    }
+    return triangles + 1;
+}
+
+int main() {
+    for (const size_t n : {1000, 4000, 8000}) {
+        const auto outline = Outline(n);
+        bench::Report("EarClipping", n, bench::TimeMs([&] { sink = EarClipping(outline); }, 1));
+        bench::Report("Triangulate", n, bench::TimeMs([&] { sink = alg::Triangulate(outline).size(); }));
+    }
+
+    std::vector<alg::Polygon> outlines;
+    for (unsigned seed = 0; seed < 500; seed++) outlines.push_back(Outline(2000, seed));
+    const size_t total = outlines.size() * 2000;
+    bench::Report("Triangulate seq, 500 polygons", total, bench::TimeMs([&] { sink = alg::Triangulate(exec::seq, outlines).size(); }, 3));
+    bench::Report("Triangulate par, 500 polygons", total, bench::TimeMs([&] { sink = alg::Triangulate(exec::par, outlines).size(); }, 3));
+}
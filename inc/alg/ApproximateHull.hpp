@@ -0,0 +1,177 @@
+//
+// Created by aamalh on 01/02/26.
+//
+
+#ifndef CPPGEOMETRY_APPROXIMATE_HULL_HPP
+#define CPPGEOMETRY_APPROXIMATE_HULL_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <mutex>
+#include <numbers>
+#include <stdexcept>
+#include <vector>
+
+#include "../exec/Policy.hpp"
+#include "../math/GeomUtils.hpp"
+#include "../math/Point.hpp"
+#include "ConvexHull.hpp"
+
+namespace geom {
+namespace alg {
+    // Fixed-memory approximate convex hull of a stream: the extreme point in each of k evenly
+    // spaced directions. Every vertex of the sketch is an input point, and every input point is
+    // within ErrorBound() <= epsilon * diameter of the sketch hull, because between neighbouring
+    // extremes p, q the true hull can only bulge out by |pq| / 2 * tan(pi / k).
+    //
+    // Points inside the current sketch hull cannot be extreme in any direction, so an interior
+    // point costs an O(1) inscribed-disk test or an O(log k) containment test. A point outside the
+    // hull costs an O(k) direction scan plus an O(k) rebuild when it becomes an extreme. Once the
+    // hull has grown to cover most of the input that is rare, so Add is O(1) amortised on typical
+    // streams but O(k) per point on adversarial ones, e.g. points in order along a circle.
+    //
+    // Sketches with the same epsilon merge exactly, so per-thread or per-node sketches combine
+    // into the sketch of the whole stream.
+    class HullSketch {
+        std::vector<float> _cos, _sin;
+        std::vector<float> _support;
+        std::vector<math::Point2f> _extremes;
+        // Distinct extremes in direction order, which is counter-clockwise along the hull
+        std::vector<math::Point2f> _hull;
+        // Disk inside _hull for an O(1) early accept of interior points
+        math::Point2f _centre;
+        float _inner_sq = -1;
+        size_t _count = 0;
+
+        void Rebuild_() {
+            _hull.clear();
+            for (const auto& p : _extremes) {
+                if (_hull.empty() || !(p == _hull.back())) _hull.push_back(p);
+            }
+            while (_hull.size() > 1 && _hull.front() == _hull.back()) _hull.pop_back();
+
+            _inner_sq = -1;
+            if (_hull.size() < 3) return;
+            math::Vector2f sum {0, 0};
+            for (const auto& p : _hull) sum = sum + p;
+            _centre = sum * (1.0f / _hull.size());
+            float inner = std::numeric_limits<float>::max();
+            for (size_t i = 0, j = _hull.size() - 1; i < _hull.size(); j = i++) {
+                const math::Vector2f edge = _hull[i] - _hull[j];
+                inner = std::min(inner, math::Cross2D(edge, _centre - _hull[j]) / edge.Norm());
+            }
+            _inner_sq = inner > 0 ? inner * inner : -1;
+        }
+
+        // Inscribed disk first, then the fan search; points on the boundary count as inside
+        [[nodiscard]] bool InsideHull_(const math::Point2f& p) const {
+            if (_hull.size() < 3) return false;
+            if (math::SquaredDistance(p, _centre) < _inner_sq) return true;
+            return detail::InsideConvex(_hull, p);
+        }
+
+    public:
+        // Smallest even k with tan(pi / k) / 2 <= epsilon
+        static size_t DirectionsFor(const float epsilon) {
+            if (!(epsilon > 0)) throw std::runtime_error("Require a positive hull error");
+            const auto k = static_cast<size_t>(std::ceil(std::numbers::pi / std::atan(2.0 * epsilon)));
+            return std::max<size_t>(4, k + k % 2);
+        }
+
+        // `epsilon` is the tolerated distance from the true hull as a fraction of its diameter
+        explicit HullSketch(const float epsilon) {
+            const size_t k = DirectionsFor(epsilon);
+            _cos.resize(k);
+            _sin.resize(k);
+            for (size_t i = 0; i < k; i++) {
+                const double angle = 2 * std::numbers::pi * i / k;
+                _cos[i] = static_cast<float>(std::cos(angle));
+                _sin[i] = static_cast<float>(std::sin(angle));
+            }
+            _support.assign(k, -std::numeric_limits<float>::infinity());
+            _extremes.resize(k);
+        }
+
+        void Add(const math::Point2f& p) {
+            const bool first = _count++ == 0;
+            if (!first && InsideHull_(p)) return;
+
+            bool changed = false;
+            for (size_t i = 0; i < _support.size(); i++) {
+                if (const float s = _cos[i] * p.x() + _sin[i] * p.y(); s > _support[i]) {
+                    _support[i] = s;
+                    _extremes[i] = p;
+                    changed = true;
+                }
+            }
+            if (changed) Rebuild_();
+        }
+
+        void Add(const std::vector<math::Point2f>& points) {
+            for (const auto& p : points) Add(p);
+        }
+
+        void Merge(const HullSketch& other) {
+            if (other._support.size() != _support.size()) {
+                throw std::runtime_error("Cannot merge hull sketches with different epsilon");
+            }
+            if (other._count == 0) return;
+            for (size_t i = 0; i < _support.size(); i++) {
+                if (other._support[i] > _support[i]) {
+                    _support[i] = other._support[i];
+                    _extremes[i] = other._extremes[i];
+                }
+            }
+            _count += other._count;
+            Rebuild_();
+        }
+
+        // Counter-clockwise and closed by repeating the first vertex, like ConvexHull2D
+        [[nodiscard]] std::vector<math::Point2f> Hull() const {
+            auto hull = _hull;
+            if (!hull.empty()) hull.push_back(hull.front());
+            return hull;
+        }
+
+        // A posteriori distance bound between the sketch hull and the true hull of every point added
+        [[nodiscard]] float ErrorBound() const {
+            if (_hull.size() < 2) return 0;
+            float longest = 0;
+            for (size_t i = 0, j = _hull.size() - 1; i < _hull.size(); j = i++) {
+                longest = std::max(longest, (_hull[i] - _hull[j]).Norm());
+            }
+            return longest / 2 * std::tan(std::numbers::pi_v<float> / _support.size());
+        }
+
+        [[nodiscard]] size_t Directions() const {
+            return _support.size();
+        }
+
+        [[nodiscard]] size_t Count() const {
+            return _count;
+        }
+    };
+
+    // Sketches blocks concurrently and merges them, the same path a sharded stream would take
+    template <exec::ExecutionPolicy P>
+    HullSketch ApproximateHull(const P& policy, const std::vector<math::Point2f>& points,
+                               const float epsilon) {
+        std::mutex mutex;
+        HullSketch result(epsilon);
+        exec::ForEachBlock(policy, points.size(), 1 << 15, [&](const size_t begin, const size_t end) {
+            HullSketch sketch(epsilon);
+            for (size_t i = begin; i < end; i++) sketch.Add(points[i]);
+            std::lock_guard lock(mutex);
+            result.Merge(sketch);
+        });
+        return result;
+    }
+
+    inline HullSketch ApproximateHull(const std::vector<math::Point2f>& points, const float epsilon) {
+        return ApproximateHull(exec::seq, points, epsilon);
+    }
+}
+} // namespace geom
+
+#endif // CPPGEOMETRY_APPROXIMATE_HULL_HPP
@@ -0,0 +1,216 @@
+//
+// Created by aamalh on 01/02/26.
+//
+
+#ifndef CPPGEOMETRY_CLOSEST_PAIR_HPP
+#define CPPGEOMETRY_CLOSEST_PAIR_HPP
+
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+#include "../exec/Policy.hpp"
+#include "../math/GeomUtils.hpp"
+#include "../math/Point.hpp"
+#include "PointPair.hpp"
+
+namespace geom {
+namespace alg {
+    namespace detail {
+        struct ClosestCandidate {
+            float squared = std::numeric_limits<float>::max();
+            math::Point2f first;
+            math::Point2f second;
+
+            void Consider(const math::Point2f& a, const math::Point2f& b) {
+                if (const float d = math::SquaredDistance(a, b); d < squared) {
+                    squared = d;
+                    first = a;
+                    second = b;
+                }
+            }
+        };
+
+        inline bool YLess(const math::Point2f& a, const math::Point2f& b) {
+            return a.y() < b.y();
+        }
+
+        // Expects [lo, hi) of `points` sorted by x and leaves it sorted by y, using the same range
+        // of `buffer` as merge and strip storage
+        template <exec::ExecutionPolicy P>
+        ClosestCandidate ClosestPairRecurse(const P& policy, std::vector<math::Point2f>& points,
+                                            std::vector<math::Point2f>& buffer, const size_t lo, const size_t hi) {
+            constexpr size_t kBruteForce = 3;
+            constexpr size_t kParallelGrain = 1 << 15;
+
+            ClosestCandidate best;
+            if (hi - lo <= kBruteForce) {
+                for (size_t i = lo; i < hi; i++)
+                    for (size_t j = i + 1; j < hi; j++) best.Consider(points[i], points[j]);
+                std::sort(points.begin() + lo, points.begin() + hi, YLess);
+                return best;
+            }
+
+            const size_t mid = lo + (hi - lo) / 2;
+            const float mid_x = points[mid].x();
+            ClosestCandidate left, right;
+            bool forked = false;
+            if constexpr (exec::ParallelExecutionPolicy<P>) {
+                if (hi - lo > kParallelGrain) {
+                    exec::TaskGroup group(policy.Pool());
+                    group.Run([&] { left = ClosestPairRecurse(policy, points, buffer, lo, mid); });
+                    right = ClosestPairRecurse(policy, points, buffer, mid, hi);
+                    group.Wait();
+                    forked = true;
+                }
+            }
+            if (!forked) {
+                left = ClosestPairRecurse(exec::seq, points, buffer, lo, mid);
+                right = ClosestPairRecurse(exec::seq, points, buffer, mid, hi);
+            }
+            best = left.squared <= right.squared ? left : right;
+
+            std::merge(points.begin() + lo, points.begin() + mid, points.begin() + mid, points.begin() + hi,
+                       buffer.begin() + lo, YLess);
+            std::copy(buffer.begin() + lo, buffer.begin() + hi, points.begin() + lo);
+
+            // Only points within the current best of the dividing line can improve on it, and each
+            // has a bounded number of strip predecessors within that distance in y
+            size_t strip_end = lo;
+            for (size_t i = lo; i < hi; i++) {
+                const math::Point2f& p = points[i];
+                const float dx = p.x() - mid_x;
+                if (dx * dx >= best.squared) continue;
+                for (size_t j = strip_end; j-- > lo;) {
+                    const float dy = p.y() - buffer[j].y();
+                    if (dy * dy >= best.squared) break;
+                    best.Consider(buffer[j], p);
+                }
+                buffer[strip_end++] = p;
+            }
+            return best;
+        }
+
+        // Implicit 2-d tree: the median of each range is its node, split alternately on x and y.
+        // Points are stored in tree order so that queries walk contiguous memory.
+        class KdTree {
+            struct Node {
+                math::Point2f point;
+                size_t index;
+            };
+            std::vector<Node> _nodes;
+
+            static float Coord_(const math::Point2f& p, const size_t axis) {
+                return axis == 0 ? p.x() : p.y();
+            }
+
+            template <exec::ExecutionPolicy P>
+            void Build_(const P& policy, const size_t lo, const size_t hi, const size_t axis) {
+                constexpr size_t kParallelGrain = 1 << 14;
+                if (hi - lo < 2) return;
+                const size_t mid = lo + (hi - lo) / 2;
+                std::nth_element(_nodes.begin() + lo, _nodes.begin() + mid, _nodes.begin() + hi,
+                                 [axis](const Node& a, const Node& b) {
+                                     return Coord_(a.point, axis) < Coord_(b.point, axis);
+                                 });
+                if constexpr (exec::ParallelExecutionPolicy<P>) {
+                    if (hi - lo > kParallelGrain) {
+                        exec::TaskGroup group(policy.Pool());
+                        group.Run([&] { Build_(policy, lo, mid, 1 - axis); });
+                        Build_(policy, mid + 1, hi, 1 - axis);
+                        group.Wait();
+                        return;
+                    }
+                }
+                Build_(exec::seq, lo, mid, 1 - axis);
+                Build_(exec::seq, mid + 1, hi, 1 - axis);
+            }
+
+            void Nearest_(const size_t query, const size_t lo, const size_t hi, const size_t axis,
+                          size_t& best, float& best_sq) const {
+                if (lo >= hi) return;
+                const size_t mid = lo + (hi - lo) / 2;
+                const math::Point2f& q = _nodes[query].point;
+                const math::Point2f& node = _nodes[mid].point;
+                if (mid != query) {
+                    if (const float d = math::SquaredDistance(q, node); d < best_sq) {
+                        best_sq = d;
+                        best = mid;
+                    }
+                }
+                const float delta = Coord_(q, axis) - Coord_(node, axis);
+                if (delta < 0) {
+                    Nearest_(query, lo, mid, 1 - axis, best, best_sq);
+                    if (delta * delta < best_sq) Nearest_(query, mid + 1, hi, 1 - axis, best, best_sq);
+                } else {
+                    Nearest_(query, mid + 1, hi, 1 - axis, best, best_sq);
+                    if (delta * delta < best_sq) Nearest_(query, lo, mid, 1 - axis, best, best_sq);
+                }
+            }
+
+        public:
+            template <exec::ExecutionPolicy P>
+            KdTree(const P& policy, const std::vector<math::Point2f>& points) {
+                _nodes.reserve(points.size());
+                for (size_t i = 0; i < points.size(); i++) _nodes.push_back({points[i], i});
+                Build_(policy, 0, _nodes.size(), 0);
+            }
+
+            [[nodiscard]] size_t Size() const {
+                return _nodes.size();
+            }
+
+            // Input index of the point stored at tree position `position`
+            [[nodiscard]] size_t Index(const size_t position) const {
+                return _nodes[position].index;
+            }
+
+            // Tree position of the nearest other point to the one at tree position `query`
+            [[nodiscard]] size_t Nearest(const size_t query) const {
+                size_t best = query;
+                float best_sq = std::numeric_limits<float>::max();
+                Nearest_(query, 0, _nodes.size(), 0, best, best_sq);
+                return best;
+            }
+        };
+    } // namespace detail
+
+    // Divide and conquer in O(n log n) over the LexicographicOrder sort
+    template <exec::ExecutionPolicy P>
+    PointPair ClosestPair(const P& policy, const std::vector<math::Point2f>& points) {
+        if (points.size() < 2) throw std::runtime_error("Require at least two points for a closest pair");
+
+        auto sorted = points;
+        math::LexicographicOrder(policy, sorted);
+        std::vector<math::Point2f> buffer(sorted.size());
+        const auto best = detail::ClosestPairRecurse(policy, sorted, buffer, 0, sorted.size());
+        return {best.first, best.second, std::sqrt(best.squared)};
+    }
+
+    inline PointPair ClosestPair(const std::vector<math::Point2f>& points) {
+        return ClosestPair(exec::seq, points);
+    }
+
+    // For each point, the index of its nearest other point. Builds a 2-d tree in O(n log n) and
+    // answers the n queries independently, so the policy parallelises both phases.
+    template <exec::ExecutionPolicy P>
+    std::vector<size_t> AllNearestNeighbours(const P& policy, const std::vector<math::Point2f>& points) {
+        if (points.size() < 2) throw std::runtime_error("Require at least two points for nearest neighbours");
+
+        const detail::KdTree tree(policy, points);
+        std::vector<size_t> neighbours(points.size());
+        // Querying in tree order keeps consecutive searches on the same cache lines
+        exec::ForEachBlock(policy, tree.Size(), 1 << 12, [&](const size_t begin, const size_t end) {
+            for (size_t k = begin; k < end; k++) neighbours[tree.Index(k)] = tree.Index(tree.Nearest(k));
+        });
+        return neighbours;
+    }
+
+    inline std::vector<size_t> AllNearestNeighbours(const std::vector<math::Point2f>& points) {
+        return AllNearestNeighbours(exec::seq, points);
+    }
+}
+} // namespace geom
+
+#endif // CPPGEOMETRY_CLOSEST_PAIR_HPP
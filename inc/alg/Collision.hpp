@@ -0,0 +1,376 @@
+//
+// Created by aamalh on 01/02/26.
+//
+
+#ifndef CPPGEOMETRY_COLLISION_HPP
+#define CPPGEOMETRY_COLLISION_HPP
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <mutex>
+#include <optional>
+#include <vector>
+
+#include "../exec/Policy.hpp"
+#include "../math/GeomUtils.hpp"
+#include "../math/Point.hpp"
+#include "PolygonClip.hpp"
+#include "RotatingCalipers.hpp"
+
+// Collision queries on convex polygons given as counter-clockwise vertices, such as the output of
+// ConvexHull2D. A repeated closing vertex is accepted everywhere.
+namespace geom {
+namespace alg {
+    struct Proximity {
+        bool overlap;
+        // Zero when overlapping, otherwise the closest points of the two polygons
+        float distance;
+        math::Point2f closest_a;
+        math::Point2f closest_b;
+    };
+
+    // Moving the second polygon by normal * depth separates the pair
+    struct Penetration {
+        float depth;
+        math::Vector2f normal;
+    };
+
+    struct Contact {
+        size_t first;
+        size_t second;
+        Penetration penetration;
+    };
+
+    namespace detail {
+        // Lowest vertex of the first n, ties broken by the smallest x, where MinkowskiSum starts
+        inline size_t LowestVertex(const std::vector<math::Point2f>& polygon, const size_t n) {
+            size_t lowest = 0;
+            for (size_t i = 1; i < n; i++) {
+                const auto& p = polygon[i];
+                const auto& q = polygon[lowest];
+                if (p.y() < q.y() || (p.y() == q.y() && p.x() < q.x())) lowest = i;
+            }
+            return lowest;
+        }
+
+        // Per-component p - q and -v. Like Advance, these bypass Vector's operators, which snap
+        // components under the IsEqual tolerance to zero and would collapse small polygons.
+        inline math::Vector2f Difference(const math::Point2f& p, const math::Point2f& q) {
+            return {p.x() - q.x(), p.y() - q.y()};
+        }
+
+        inline math::Vector2f Negated(const math::Vector2f& v) {
+            return {-v.x(), -v.y()};
+        }
+
+        // Largest side of the bounding box of the first n vertices
+        inline float BoxExtent(const std::vector<math::Point2f>& polygon, const size_t n) {
+            float min_x = polygon[0].x(), max_x = min_x, min_y = polygon[0].y(), max_y = min_y;
+            for (size_t i = 1; i < n; i++) {
+                min_x = std::min(min_x, polygon[i].x());
+                max_x = std::max(max_x, polygon[i].x());
+                min_y = std::min(min_y, polygon[i].y());
+                max_y = std::max(max_y, polygon[i].y());
+            }
+            return std::max(max_x - min_x, max_y - min_y);
+        }
+
+        inline size_t SupportIndex(const std::vector<math::Point2f>& polygon, const size_t n, const math::Vector2f& d) {
+            size_t best = 0;
+            float best_dot = math::Dot(polygon[0], d);
+            for (size_t i = 1; i < n; i++) {
+                if (const float dot = math::Dot(polygon[i], d); dot > best_dot) {
+                    best_dot = dot;
+                    best = i;
+                }
+            }
+            return best;
+        }
+
+        // Vertex of the Minkowski difference a - b, remembering which vertices produced it
+        struct SupportPoint {
+            math::Point2f point;
+            math::Point2f a;
+            math::Point2f b;
+        };
+
+        class MinkowskiDifference {
+            const std::vector<math::Point2f>& _a;
+            const std::vector<math::Point2f>& _b;
+            size_t _na, _nb;
+            float _extent;
+
+        public:
+            MinkowskiDifference(const std::vector<math::Point2f>& a, const std::vector<math::Point2f>& b)
+                : _a(a), _b(b), _na(HullSize(a)), _nb(HullSize(b)), _extent(BoxExtent(a, _na) + BoxExtent(b, _nb)) {}
+
+            [[nodiscard]] SupportPoint Support(const math::Vector2f& d) const {
+                const auto& pa = _a[SupportIndex(_a, _na, d)];
+                const auto& pb = _b[SupportIndex(_b, _nb, Negated(d))];
+                return {Difference(pa, pb), pa, pb};
+            }
+
+            // Every simplex vertex has to be a support point, even the first: EPA relies on the
+            // simplex lying on the boundary to keep its polytope convex
+            [[nodiscard]] SupportPoint Initial() const {
+                const math::Vector2f d = Difference(_a[0], _b[0]);
+                return Support(d.x() == 0 && d.y() == 0 ? math::Vector2f {1, 0} : d);
+            }
+
+            // Bounds the size of a - b, which the GJK and EPA tolerances are relative to
+            [[nodiscard]] float Extent() const {
+                return _extent;
+            }
+        };
+
+        // Reduces the GJK simplex to the sub-simplex nearest the origin and returns the
+        // barycentric weights of the nearest point, or nothing if a triangle contains the origin
+        inline std::optional<std::array<float, 3>> NearestSimplex(std::vector<SupportPoint>& simplex) {
+            auto segment = [](const math::Point2f& p, const math::Point2f& q) {
+                const math::Vector2f edge = Difference(q, p);
+                const float length_sq = math::Dot(edge, edge);
+                return length_sq > 0 ? std::clamp<float>(-math::Dot(p, edge) / length_sq, 0, 1) : 0.0f;
+            };
+
+            if (simplex.size() == 1) return std::array<float, 3> {1, 0, 0};
+            if (simplex.size() == 2) {
+                const float t = segment(simplex[0].point, simplex[1].point);
+                if (t == 0) simplex.pop_back();
+                else if (t == 1) simplex.erase(simplex.begin());
+                else return std::array<float, 3> {1 - t, t, 0};
+                return std::array<float, 3> {1, 0, 0};
+            }
+
+            const auto& p0 = simplex[0].point;
+            const auto& p1 = simplex[1].point;
+            const auto& p2 = simplex[2].point;
+            const float c0 = math::Cross2D(Difference(p1, p0), Negated(p0));
+            const float c1 = math::Cross2D(Difference(p2, p1), Negated(p1));
+            const float c2 = math::Cross2D(Difference(p0, p2), Negated(p2));
+            if ((c0 >= 0 && c1 >= 0 && c2 >= 0) || (c0 <= 0 && c1 <= 0 && c2 <= 0)) return std::nullopt;
+
+            // Origin outside the triangle, so the nearest point lies on one of its edges
+            size_t best_edge = 0;
+            float best_sq = std::numeric_limits<float>::max();
+            for (size_t e = 0; e < 3; e++) {
+                const auto& p = simplex[e].point;
+                const auto& q = simplex[(e + 1) % 3].point;
+                const float t = segment(p, q);
+                const math::Point2f nearest = Advance(p, Difference(q, p), t);
+                if (const float sq = math::Dot(nearest, nearest); sq < best_sq) {
+                    best_sq = sq;
+                    best_edge = e;
+                }
+            }
+            simplex = {simplex[best_edge], simplex[(best_edge + 1) % 3]};
+            return NearestSimplex(simplex);
+        }
+
+        struct GjkResult {
+            bool overlap;
+            std::vector<SupportPoint> simplex;
+            std::array<float, 3> weights;
+        };
+
+        inline GjkResult Gjk(const MinkowskiDifference& shape) {
+            constexpr int kMaxIterations = 64;
+            // Fraction of the shape's extent, so the answer does not depend on the units
+            constexpr float kTolerance = 1e-6f;
+            const float extent_sq = shape.Extent() * shape.Extent();
+
+            std::vector<SupportPoint> simplex {shape.Initial()};
+            std::array<float, 3> weights {1, 0, 0};
+            math::Vector2f v = simplex[0].point;
+            for (int i = 0; i < kMaxIterations; i++) {
+                const float v_sq = math::Dot(v, v);
+                if (v_sq <= kTolerance * kTolerance * extent_sq) return {true, simplex, weights};
+
+                const SupportPoint w = shape.Support(Negated(v));
+                // No support point is meaningfully closer than v, so v is the nearest point
+                if (v_sq - math::Dot(v, w.point) <= kTolerance * std::max(v_sq, extent_sq)) break;
+
+                simplex.push_back(w);
+                const auto nearest = NearestSimplex(simplex);
+                if (!nearest) return {true, simplex, weights};
+                weights = *nearest;
+                v = math::Vector2f {0, 0};
+                for (size_t k = 0; k < simplex.size(); k++) v = Advance(v, simplex[k].point, weights[k]);
+            }
+            return {false, simplex, weights};
+        }
+
+        // Expanding polytope: grows the GJK triangle towards the boundary of a - b until the edge
+        // nearest the origin is on the boundary
+        inline Penetration Epa(const MinkowskiDifference& shape, std::vector<SupportPoint> simplex) {
+            constexpr int kMaxIterations = 64;
+            // Fraction of the shape's extent, as in Gjk
+            constexpr float kTolerance = 1e-5f;
+            const float extent = shape.Extent();
+
+            std::vector<math::Point2f> polytope;
+            for (const auto& s : simplex) polytope.push_back(s.point);
+            if (polytope.size() == 3) {
+                const float area = math::Cross2D(Difference(polytope[1], polytope[0]), Difference(polytope[2], polytope[0]));
+                if (area < 0) std::swap(polytope[1], polytope[2]);
+                // A flat triangle keeps only its longest side
+                if (std::abs(area) <= kTolerance * kTolerance * extent * extent) {
+                    std::ranges::sort(polytope, [](const math::Point2f& p, const math::Point2f& q) {
+                        return p.x() < q.x() || (p.x() == q.x() && p.y() < q.y());
+                    });
+                    polytope = {polytope.front(), polytope.back()};
+                }
+            }
+
+            // GJK stops as soon as the origin is on its simplex, which may be a point or a segment.
+            // Blow it up to a polygon around the origin with supports on either side of it.
+            if (polytope.size() == 1) {
+                const math::Point2f p = shape.Support({1, 0}).point;
+                const bool same = p.x() == polytope[0].x() && p.y() == polytope[0].y();
+                polytope.push_back(same ? shape.Support({-1, 0}).point : p);
+            }
+            if (polytope.size() == 2) {
+                const math::Vector2f edge = Difference(polytope[1], polytope[0]);
+                const math::Vector2f left {-edge.y(), edge.x()};
+                const math::Point2f p0 = polytope[0], p1 = polytope[1];
+                const math::Point2f right_support = shape.Support(Negated(left)).point;
+                const math::Point2f left_support = shape.Support(left).point;
+                polytope = {p0};
+                if (math::Cross2D(edge, Difference(right_support, p0)) < 0) polytope.push_back(right_support);
+                polytope.push_back(p1);
+                if (math::Cross2D(edge, Difference(left_support, p0)) > 0) polytope.push_back(left_support);
+                // Flat Minkowski difference, so the polygons only touch
+                if (polytope.size() < 3) return {0, {1, 0}};
+            }
+
+            Penetration best {0, {1, 0}};
+            for (int i = 0; i < kMaxIterations; i++) {
+                size_t nearest_edge = 0;
+                best.depth = std::numeric_limits<float>::max();
+                for (size_t e = 0; e < polytope.size(); e++) {
+                    const math::Vector2f edge = Difference(polytope[(e + 1) % polytope.size()], polytope[e]);
+                    const float length = edge.Norm();
+                    if (length == 0) continue;
+                    const math::Vector2f normal {edge.y() / length, -edge.x() / length};
+                    if (const float distance = math::Dot(normal, polytope[e]); distance < best.depth) {
+                        best = {distance, normal};
+                        nearest_edge = e;
+                    }
+                }
+                const math::Point2f w = shape.Support(best.normal).point;
+                if (math::Dot(best.normal, w) - best.depth <= kTolerance * std::max(best.depth, extent)) break;
+                polytope.insert(polytope.begin() + nearest_edge + 1, w);
+            }
+            best.depth = std::max(best.depth, 0.0f);
+            return best;
+        }
+    } // namespace detail
+
+    // Sum of two convex polygons in O(n + m) by merging their edges in angular order. The result is
+    // counter-clockwise, without a repeated closing vertex, and starts at its lowest vertex.
+    inline Polygon MinkowskiSum(const std::vector<math::Point2f>& a, const std::vector<math::Point2f>& b) {
+        const size_t na = detail::HullSize(a);
+        const size_t nb = detail::HullSize(b);
+        const size_t sa = detail::LowestVertex(a, na);
+        const size_t sb = detail::LowestVertex(b, nb);
+
+        Polygon sum;
+        sum.reserve(na + nb);
+        size_t i = 0, j = 0;
+        while (i < na || j < nb) {
+            const math::Point2f& pa = a[(sa + i) % na];
+            const math::Point2f& pb = b[(sb + j) % nb];
+            sum.push_back(detail::Advance(pa, pb, 1));
+            const math::Vector2f ea = detail::Difference(a[(sa + i + 1) % na], pa);
+            const math::Vector2f eb = detail::Difference(b[(sb + j + 1) % nb], pb);
+            const float turn = math::Cross2D(ea, eb);
+            if (j == nb || (i < na && turn > 0)) i++;
+            else if (i == na || turn < 0) j++;
+            else {
+                // Parallel edges merge into one
+                i++;
+                j++;
+            }
+        }
+        return sum;
+    }
+
+    // GJK on the Minkowski difference; converges in a handful of support queries for hull polygons
+    inline Proximity ConvexDistance(const std::vector<math::Point2f>& a, const std::vector<math::Point2f>& b) {
+        const detail::MinkowskiDifference shape(a, b);
+        const auto result = detail::Gjk(shape);
+        if (result.overlap) return {true, 0, {}, {}};
+
+        math::Point2f closest_a {0, 0}, closest_b {0, 0};
+        for (size_t k = 0; k < result.simplex.size(); k++) {
+            closest_a = detail::Advance(closest_a, result.simplex[k].a, result.weights[k]);
+            closest_b = detail::Advance(closest_b, result.simplex[k].b, result.weights[k]);
+        }
+        return {false, detail::Difference(closest_a, closest_b).Norm(), closest_a, closest_b};
+    }
+
+    // Depth and direction of the overlap by EPA, or nothing if the polygons are disjoint
+    inline std::optional<Penetration> PenetrationDepth(const std::vector<math::Point2f>& a, const std::vector<math::Point2f>& b) {
+        const detail::MinkowskiDifference shape(a, b);
+        auto result = detail::Gjk(shape);
+        if (!result.overlap) return std::nullopt;
+        return detail::Epa(shape, std::move(result.simplex));
+    }
+
+    // Every overlapping pair of polygons with its penetration, ordered by (first, second).
+    // Sweep and prune on x-sorted bounding boxes is the broad phase, and only pairs whose boxes
+    // overlap go through GJK and EPA. Both phases are split into blocks of the sweep order.
+    template <exec::ExecutionPolicy P>
+    std::vector<Contact> FindContacts(const P& policy, const std::vector<std::vector<math::Point2f>>& polygons) {
+        struct Box {
+            float min_x, max_x, min_y, max_y;
+            size_t index;
+        };
+        std::vector<Box> boxes(polygons.size());
+        exec::ForEachBlock(policy, polygons.size(), 1 << 10, [&](const size_t begin, const size_t end) {
+            for (size_t i = begin; i < end; i++) {
+                Box box {std::numeric_limits<float>::max(), std::numeric_limits<float>::lowest(),
+                         std::numeric_limits<float>::max(), std::numeric_limits<float>::lowest(), i};
+                for (const auto& p : polygons[i]) {
+                    box.min_x = std::min(box.min_x, p.x());
+                    box.max_x = std::max(box.max_x, p.x());
+                    box.min_y = std::min(box.min_y, p.y());
+                    box.max_y = std::max(box.max_y, p.y());
+                }
+                boxes[i] = box;
+            }
+        });
+        exec::Sort(policy, boxes.begin(), boxes.end(), [](const Box& a, const Box& b) { return a.min_x < b.min_x; });
+
+        std::mutex mutex;
+        std::vector<Contact> contacts;
+        exec::ForEachBlock(policy, boxes.size(), 1 << 8, [&](const size_t begin, const size_t end) {
+            std::vector<Contact> found;
+            for (size_t i = begin; i < end; i++) {
+                const Box& a = boxes[i];
+                for (size_t j = i + 1; j < boxes.size() && boxes[j].min_x <= a.max_x; j++) {
+                    const Box& b = boxes[j];
+                    if (b.min_y > a.max_y || b.max_y < a.min_y) continue;
+                    const size_t first = std::min(a.index, b.index), second = std::max(a.index, b.index);
+                    if (const auto penetration = PenetrationDepth(polygons[first], polygons[second])) {
+                        found.push_back({first, second, *penetration});
+                    }
+                }
+            }
+            std::lock_guard lock(mutex);
+            contacts.insert(contacts.end(), found.begin(), found.end());
+        });
+        std::ranges::sort(contacts, [](const Contact& a, const Contact& b) {
+            return a.first < b.first || (a.first == b.first && a.second < b.second);
+        });
+        return contacts;
+    }
+
+    inline std::vector<Contact> FindContacts(const std::vector<std::vector<math::Point2f>>& polygons) {
+        return FindContacts(exec::seq, polygons);
+    }
+}
+} // namespace geom
+
+#endif // CPPGEOMETRY_COLLISION_HPP
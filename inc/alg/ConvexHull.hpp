@@ -5,22 +5,29 @@
 #ifndef CPPGEOMETRY_CONVEX_HULL_HPP
 #define CPPGEOMETRY_CONVEX_HULL_HPP
 
+#include <mutex>
+#include <span>
 #include <vector>
 
+#include "../exec/Policy.hpp"
 #include "../math/GeomUtils.hpp"
 #include "../math/Point.hpp"
 
 namespace geom {
 namespace alg {
-    inline std::vector<math::Point2f> HalfHull(const std::vector<math::Point2f>& points) {
-        std::vector<math::Point2f> hull;
+    // The hulls work on any coordinate type. Eval is the type the orientation predicate is
+    // evaluated in, Wide<T> by default, so ConvexHull2D<double>(points) on float points keeps the
+    // float storage but decides turns in double.
+    template <math::EvaluationType Eval = void, math::Arithmetic T = float>
+    std::vector<math::Vector<T, math::DIM2>> HalfHull(const std::vector<math::Vector<T, math::DIM2>>& points) {
+        std::vector<math::Vector<T, math::DIM2>> hull;
         hull.reserve(points.size());
         hull.push_back(points[0]);
         hull.push_back(points[1]);
         for (size_t i = 2; i < points.size(); i++) {
             hull.push_back(points[i]);
             while (hull.size() > 2) {
-                const math::Orientation orientation = math::Orientation2d(
+                const math::Orientation orientation = math::Orientation2d<Eval>(
                     hull[hull.size() - 3],
                     hull[hull.size() - 2],
                     hull[hull.size() - 1]
@@ -32,18 +39,93 @@ namespace alg {
         }
         return hull;
     }
-    inline std::vector<math::Point2f> ConvexHull2D(const std::vector<math::Point2f>& points) {
+    template <math::EvaluationType Eval = void, math::Arithmetic T = float>
+    std::vector<math::Vector<T, math::DIM2>> ConvexHull2D(const std::vector<math::Vector<T, math::DIM2>>& points) {
 
         auto new_points = points;
         math::LexicographicOrder(new_points);
-        std::vector<math::Point2f> upper_hull = HalfHull(new_points);
+        std::vector<math::Vector<T, math::DIM2>> upper_hull = HalfHull<Eval>(new_points);
 
         std::ranges::reverse(new_points);
-        std::vector<math::Point2f> lower_hull = HalfHull(new_points);
+        std::vector<math::Vector<T, math::DIM2>> lower_hull = HalfHull<Eval>(new_points);
 
         upper_hull.insert(upper_hull.end(), lower_hull.begin() + 1, lower_hull.end() );
         return upper_hull;
     }
+
+    // Hulls blocks of the input concurrently and then hulls the union of their vertices, which
+    // is small, so only the final pass is sequential
+    template <math::EvaluationType Eval = void, exec::ExecutionPolicy P, math::Arithmetic T = float>
+    std::vector<math::Vector<T, math::DIM2>> ConvexHull2D(const P& policy, const std::vector<math::Vector<T, math::DIM2>>& points) {
+        constexpr size_t kGrain = 1 << 15;
+        if (!exec::ParallelExecutionPolicy<P> || points.size() < 2 * kGrain) return ConvexHull2D<Eval>(points);
+
+        std::mutex mutex;
+        std::vector<math::Vector<T, math::DIM2>> candidates;
+        exec::ForEachBlock(policy, points.size(), kGrain, [&](const size_t begin, const size_t end) {
+            const auto block_hull = ConvexHull2D<Eval>(std::vector(points.begin() + begin, points.begin() + end));
+            std::lock_guard lock(mutex);
+            candidates.insert(candidates.end(), block_hull.begin(), block_hull.end());
+        });
+        return ConvexHull2D<Eval>(candidates);
+    }
+
+    namespace detail {
+        // O(log n) binary search over the fan from hull[0] of an open counter-clockwise hull with
+        // at least three vertices; points on the boundary count as inside
+        inline bool InsideConvex(const std::span<const math::Point2f> hull, const math::Point2f& p) {
+            const size_t n = hull.size();
+            const math::Point2f& o = hull[0];
+            if (math::Cross2D(hull[1] - o, p - o) < 0 || math::Cross2D(hull[n - 1] - o, p - o) > 0) return false;
+            size_t lo = 1, hi = n - 1;
+            while (hi - lo > 1) {
+                const size_t mid = (lo + hi) / 2;
+                if (math::Cross2D(hull[mid] - o, p - o) >= 0) lo = mid;
+                else hi = mid;
+            }
+            return math::Cross2D(hull[hi] - hull[lo], p - hull[lo]) >= 0;
+        }
+    } // namespace detail
+
+    // Hull of a stream of batches. Points inside the current hull are dropped by an O(log h) test
+    // and only the rest are hulled together with the current vertices, so a batch costs
+    // O(b log h) plus a sort of the points that actually move the hull.
+    class IncrementalHull {
+        // Closed as returned by ConvexHull2D, or the raw points while there are fewer than three
+        std::vector<math::Point2f> _hull;
+        std::vector<math::Point2f> _candidates;
+        size_t _count = 0;
+
+    public:
+        // Returns whether the hull changed
+        bool Add(const std::span<const math::Point2f> points) {
+            _count += points.size();
+            const bool polygon = _hull.size() > 3;
+            const std::span<const math::Point2f> open(_hull.data(), polygon ? _hull.size() - 1 : _hull.size());
+            _candidates.assign(open.begin(), open.end());
+            for (const auto& p : points) {
+                if (!polygon || !detail::InsideConvex(open, p)) _candidates.push_back(p);
+            }
+            if (_candidates.size() == open.size()) return false;
+            // Too few points to hull yet, keep them all until there are
+            if (_candidates.size() < 3) _hull = _candidates;
+            else _hull = ConvexHull2D(_candidates);
+            return true;
+        }
+
+        [[nodiscard]] const std::vector<math::Point2f>& Hull() const {
+            return _hull;
+        }
+
+        [[nodiscard]] size_t Count() const {
+            return _count;
+        }
+
+        void Clear() {
+            _hull.clear();
+            _count = 0;
+        }
+    };
 }
 } // namespace geom
 
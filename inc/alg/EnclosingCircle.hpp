@@ -0,0 +1,98 @@
+//
+// Created by aamalh on 01/02/26.
+//
+
+#ifndef CPPGEOMETRY_ENCLOSING_CIRCLE_HPP
+#define CPPGEOMETRY_ENCLOSING_CIRCLE_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <concepts>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+#include "../math/GeomUtils.hpp"
+#include "../math/Point.hpp"
+
+namespace geom {
+namespace alg {
+    struct Circle {
+        math::Point2f center;
+        float radius;
+
+        [[nodiscard]] bool Contains(const math::Point2f& p) const {
+            const math::Vector2f d {p.x() - center.x(), p.y() - center.y()};
+            // Relative slack so points on the boundary are not rejected through rounding
+            const float r = radius * (1 + 1e-5f);
+            return math::Dot(d, d) <= r * r;
+        }
+    };
+
+    // Arithmetic here is per component: Vector's operators snap components under the IsEqual
+    // tolerance to zero, which would distort circles a few thousandths across
+    namespace detail {
+        inline Circle CircleFrom2(const math::Point2f& a, const math::Point2f& b) {
+            const math::Point2f center {(a.x() + b.x()) * 0.5f, (a.y() + b.y()) * 0.5f};
+            return {center, math::Vector2f {a.x() - center.x(), a.y() - center.y()}.Norm()};
+        }
+
+        inline Circle CircleFrom3(const math::Point2f& a, const math::Point2f& b, const math::Point2f& c) {
+            // Fraction of |ab| * |ac| below which the cross product counts as collinear, so
+            // that the test means the same at any scale
+            constexpr float kCollinear = 1e-6f;
+            const math::Vector2f ab {b.x() - a.x(), b.y() - a.y()};
+            const math::Vector2f ac {c.x() - a.x(), c.y() - a.y()};
+            const float d = 2 * math::Cross2D(ab, ac);
+            if (std::abs(d) <= 2 * kCollinear * ab.Norm() * ac.Norm()) {
+                // Collinear, the circle is spanned by the two farthest points
+                const Circle c1 = CircleFrom2(a, b);
+                const Circle c2 = CircleFrom2(a, c);
+                const Circle c3 = CircleFrom2(b, c);
+                if (c1.radius >= c2.radius && c1.radius >= c3.radius) return c1;
+                return c2.radius >= c3.radius ? c2 : c3;
+            }
+            const float ab_sq = math::Dot(ab, ab);
+            const float ac_sq = math::Dot(ac, ac);
+            const math::Vector2f offset {
+                (ac.y() * ab_sq - ab.y() * ac_sq) / d,
+                (ab.x() * ac_sq - ac.x() * ab_sq) / d
+            };
+            return {{a.x() + offset.x(), a.y() + offset.y()}, offset.Norm()};
+        }
+    } // namespace detail
+
+    // Welzl's algorithm, in expected O(n) after a shuffle drawn from `rng`. Passing the
+    // ConvexHull2D output rather than the raw cloud gives the same circle from far fewer points.
+    template <std::uniform_random_bit_generator Rng>
+    Circle MinimumEnclosingCircle(const std::vector<math::Point2f>& points, Rng&& rng) {
+        if (points.empty()) throw std::runtime_error("Require at least one point for an enclosing circle");
+
+        auto shuffled = points;
+        std::ranges::shuffle(shuffled, rng);
+
+        Circle circle {shuffled[0], 0};
+        for (size_t i = 1; i < shuffled.size(); i++) {
+            if (circle.Contains(shuffled[i])) continue;
+            circle = {shuffled[i], 0};
+            for (size_t j = 0; j < i; j++) {
+                if (circle.Contains(shuffled[j])) continue;
+                circle = detail::CircleFrom2(shuffled[i], shuffled[j]);
+                for (size_t k = 0; k < j; k++) {
+                    if (circle.Contains(shuffled[k])) continue;
+                    circle = detail::CircleFrom3(shuffled[i], shuffled[j], shuffled[k]);
+                }
+            }
+        }
+        return circle;
+    }
+
+    // Shuffles with a fixed seed, so the same input always takes the same path and gives the
+    // same circle down to rounding
+    inline Circle MinimumEnclosingCircle(const std::vector<math::Point2f>& points) {
+        return MinimumEnclosingCircle(points, std::minstd_rand {});
+    }
+}
+} // namespace geom
+
+#endif // CPPGEOMETRY_ENCLOSING_CIRCLE_HPP
@@ -0,0 +1,20 @@
+//
+// Created by aamalh on 01/02/26.
+//
+
+#ifndef CPPGEOMETRY_POINT_PAIR_HPP
+#define CPPGEOMETRY_POINT_PAIR_HPP
+
+#include "../math/Point.hpp"
+
+namespace geom {
+namespace alg {
+    struct PointPair {
+        math::Point2f first;
+        math::Point2f second;
+        float distance;
+    };
+}
+} // namespace geom
+
+#endif // CPPGEOMETRY_POINT_PAIR_HPP
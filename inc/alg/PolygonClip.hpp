@@ -0,0 +1,330 @@
+//
+// Created by aamalh on 01/02/26.
+//
+
+#ifndef CPPGEOMETRY_POLYGON_CLIP_HPP
+#define CPPGEOMETRY_POLYGON_CLIP_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <utility>
+#include <vector>
+
+#include "../exec/Policy.hpp"
+#include "../math/GeomUtils.hpp"
+#include "../math/Point.hpp"
+
+namespace geom {
+namespace alg {
+    // Vertices of a simple polygon without a repeated closing vertex
+    typedef std::vector<math::Point2f> Polygon;
+
+    enum class BooleanOperation {
+        INTERSECTION,
+        UNION,
+        DIFFERENCE
+    };
+
+    // Twice the signed area, positive for counter-clockwise polygons
+    inline float SignedArea2(const Polygon& polygon) {
+        float area = 0;
+        for (size_t i = 0, j = polygon.size() - 1; i < polygon.size(); j = i++) {
+            area += math::Cross2D(polygon[j], polygon[i]);
+        }
+        return area;
+    }
+
+    // Crossing-number test, points on the boundary may go either way
+    inline bool Contains(const Polygon& polygon, const math::Point2f& p) {
+        bool inside = false;
+        for (size_t i = 0, j = polygon.size() - 1; i < polygon.size(); j = i++) {
+            const math::Point2f& a = polygon[i];
+            const math::Point2f& b = polygon[j];
+            if ((a.y() > p.y()) != (b.y() > p.y())
+                && p.x() < (b.x() - a.x()) * (p.y() - a.y()) / (b.y() - a.y()) + a.x()) {
+                inside = !inside;
+            }
+        }
+        return inside;
+    }
+
+    namespace detail {
+        // p + d * t. Vector's operators snap components under the IsEqual tolerance to zero,
+        // which would swallow the offsets of polygons only a few thousandths across.
+        inline math::Point2f Advance(const math::Point2f& p, const math::Vector2f& d, const float t) {
+            return {p.x() + d.x() * t, p.y() + d.y() * t};
+        }
+
+        // Sutherland-Hodgman against a counter-clockwise convex window, ping-ponging between
+        // `result` and `scratch` so a caller that reuses them allocates nothing in steady state
+        inline void ClipConvexInto(const Polygon& polygon, const Polygon& window, Polygon& result, Polygon& scratch) {
+            result.assign(polygon.begin(), polygon.end());
+            for (size_t e = 0; e < window.size() && !result.empty(); e++) {
+                const math::Point2f& a = window[e];
+                const math::Vector2f edge = window[(e + 1) % window.size()] - a;
+                std::swap(result, scratch);
+                result.clear();
+
+                const math::Point2f* prev = &scratch.back();
+                float prev_side = math::Cross2D(edge, *prev - a);
+                for (const math::Point2f& curr : scratch) {
+                    const float curr_side = math::Cross2D(edge, curr - a);
+                    if ((curr_side >= 0) != (prev_side >= 0)) {
+                        const float t = prev_side / (prev_side - curr_side);
+                        result.push_back(Advance(*prev, curr - *prev, t));
+                    }
+                    if (curr_side >= 0) result.push_back(curr);
+                    prev = &curr;
+                    prev_side = curr_side;
+                }
+            }
+        }
+
+        inline Polygon CounterClockwise(Polygon polygon) {
+            if (SignedArea2(polygon) < 0) std::ranges::reverse(polygon);
+            return polygon;
+        }
+
+        // Greiner-Hormann: both polygons become linked rings with their crossings spliced in,
+        // crossings are flagged as entries or exits of the other polygon, and the result is
+        // traced by switching rings at every crossing
+        class BooleanTracer {
+            struct Node {
+                math::Point2f point;
+                size_t next;
+                size_t prev;
+                size_t neighbour = 0;
+                float alpha = 0;
+                bool intersect = false;
+                bool entry = false;
+                bool visited = false;
+            };
+
+            std::array<std::vector<Node>, 2> _rings;
+
+            static std::vector<Node> MakeRing_(const Polygon& polygon) {
+                std::vector<Node> ring;
+                ring.reserve(polygon.size() * 2);
+                for (size_t i = 0; i < polygon.size(); i++) {
+                    ring.push_back({polygon[i], (i + 1) % polygon.size(), (i + polygon.size() - 1) % polygon.size()});
+                }
+                return ring;
+            }
+
+            // Splices a crossing into the edge that starts at original vertex `vertex`
+            static size_t Insert_(std::vector<Node>& ring, const size_t vertex, const math::Point2f& point, const float alpha) {
+                size_t after = vertex;
+                while (ring[ring[after].next].intersect && ring[ring[after].next].alpha < alpha) after = ring[after].next;
+                const size_t index = ring.size();
+                ring.push_back({point, ring[after].next, after, 0, alpha, true});
+                ring[ring[after].next].prev = index;
+                ring[after].next = index;
+                return index;
+            }
+
+            void MarkEntries_(const size_t r, const Polygon& other, const bool forwards) {
+                bool status = forwards != Contains(other, _rings[r][0].point);
+                size_t i = 0;
+                do {
+                    if (_rings[r][i].intersect) {
+                        _rings[r][i].entry = status;
+                        status = !status;
+                    }
+                    i = _rings[r][i].next;
+                } while (i != 0);
+            }
+
+        public:
+            // False when a vertex touches the other boundary or edges overlap, which the caller
+            // resolves by perturbing the input. Tolerances are fractions of the edge lengths, so
+            // the same polygons give the same answer at any scale.
+            bool Build(const Polygon& subject, const Polygon& clip) {
+                constexpr float kDegenerate = 1e-5f;
+                _rings = {MakeRing_(subject), MakeRing_(clip)};
+                for (size_t i = 0; i < subject.size(); i++) {
+                    const math::Point2f& a = subject[i];
+                    const math::Vector2f da = subject[(i + 1) % subject.size()] - a;
+                    const float la = da.Norm();
+                    for (size_t j = 0; j < clip.size(); j++) {
+                        const math::Point2f& b = clip[j];
+                        const math::Vector2f db = clip[(j + 1) % clip.size()] - b;
+                        const math::Vector2f offset = b - a;
+                        const float lb = db.Norm();
+                        const float denominator = math::Cross2D(da, db);
+
+                        if (std::abs(denominator) <= kDegenerate * la * lb) {
+                            // Parallel: only degenerate when the edges lie on one another
+                            if (std::abs(math::Cross2D(da, offset)) > kDegenerate * la * std::max(la, lb)) continue;
+                            const float first = math::Dot(offset, da) / (la * la);
+                            const float last = first + math::Dot(db, da) / (la * la);
+                            if (std::max(first, last) < -kDegenerate || std::min(first, last) > 1 + kDegenerate) continue;
+                            return false;
+                        }
+
+                        const float s = math::Cross2D(offset, db) / denominator;
+                        const float t = math::Cross2D(offset, da) / denominator;
+                        if (s < -kDegenerate || s > 1 + kDegenerate || t < -kDegenerate || t > 1 + kDegenerate) continue;
+                        if (s < kDegenerate || s > 1 - kDegenerate || t < kDegenerate || t > 1 - kDegenerate) return false;
+
+                        const math::Point2f point = Advance(a, da, s);
+                        const size_t in_subject = Insert_(_rings[0], i, point, s);
+                        const size_t in_clip = Insert_(_rings[1], j, point, t);
+                        _rings[0][in_subject].neighbour = in_clip;
+                        _rings[1][in_clip].neighbour = in_subject;
+                    }
+                }
+                return true;
+            }
+
+            [[nodiscard]] size_t Crossings() const {
+                return std::ranges::count_if(_rings[0], [](const Node& n) { return n.intersect; });
+            }
+
+            std::vector<Polygon> Trace(const Polygon& subject, const Polygon& clip, const BooleanOperation op) {
+                MarkEntries_(0, clip, op == BooleanOperation::INTERSECTION);
+                MarkEntries_(1, subject, op != BooleanOperation::UNION);
+
+                std::vector<Polygon> result;
+                for (size_t start = 0; start < _rings[0].size(); start++) {
+                    if (!_rings[0][start].intersect || _rings[0][start].visited) continue;
+
+                    Polygon polygon {_rings[0][start].point};
+                    size_t r = 0, i = start;
+                    do {
+                        _rings[r][i].visited = true;
+                        _rings[1 - r][_rings[r][i].neighbour].visited = true;
+                        const bool forwards = _rings[r][i].entry;
+                        do {
+                            i = forwards ? _rings[r][i].next : _rings[r][i].prev;
+                            polygon.push_back(_rings[r][i].point);
+                        } while (!_rings[r][i].intersect);
+                        i = _rings[r][i].neighbour;
+                        r = 1 - r;
+                    } while (!_rings[r][i].visited);
+
+                    if (polygon.size() > 1 && polygon.front() == polygon.back()) polygon.pop_back();
+                    if (polygon.size() >= 3) result.push_back(std::move(polygon));
+                }
+                return result;
+            }
+        };
+
+        // Traced rings come out with either winding, so each is made counter-clockwise and then
+        // flipped to clockwise when it is nested inside an odd number of the others
+        inline void OrientRings(std::vector<Polygon>& rings) {
+            for (auto& ring : rings) ring = CounterClockwise(std::move(ring));
+
+            std::vector<bool> holes(rings.size());
+            for (size_t i = 0; i < rings.size(); i++) {
+                // Rings share crossing vertices, so probe just inside the middle of the longest
+                // edge, by a fraction of its length
+                const Polygon& ring = rings[i];
+                math::Point2f start = ring.back();
+                math::Vector2f edge = ring.front() - ring.back();
+                for (size_t k = 0; k + 1 < ring.size(); k++) {
+                    const math::Vector2f candidate = ring[k + 1] - ring[k];
+                    if (math::Dot(candidate, candidate) > math::Dot(edge, edge)) {
+                        start = ring[k];
+                        edge = candidate;
+                    }
+                }
+                const math::Point2f probe = Advance(Advance(start, edge, 0.5f), math::Vector2f {-edge.y(), edge.x()}, 1e-4f);
+                size_t depth = 0;
+                for (size_t j = 0; j < rings.size(); j++) depth += j != i && Contains(rings[j], probe);
+                holes[i] = depth % 2 == 1;
+            }
+            for (size_t i = 0; i < rings.size(); i++) {
+                if (holes[i]) std::ranges::reverse(rings[i]);
+            }
+        }
+
+        // Result when the boundaries do not cross: one polygon is inside the other, or they are disjoint
+        inline std::vector<Polygon> NestedBoolean(const Polygon& subject, const Polygon& clip, const BooleanOperation op) {
+            const bool subject_in_clip = Contains(clip, subject[0]);
+            const bool clip_in_subject = Contains(subject, clip[0]);
+            switch (op) {
+            case BooleanOperation::INTERSECTION:
+                if (subject_in_clip) return {subject};
+                if (clip_in_subject) return {clip};
+                return {};
+            case BooleanOperation::UNION:
+                if (subject_in_clip) return {clip};
+                if (clip_in_subject) return {subject};
+                return {subject, clip};
+            case BooleanOperation::DIFFERENCE:
+                if (subject_in_clip) return {};
+                if (clip_in_subject) {
+                    // Outer boundary counter-clockwise, hole clockwise
+                    Polygon hole = clip;
+                    std::ranges::reverse(hole);
+                    return {subject, hole};
+                }
+                return {subject};
+            }
+            return {};
+        }
+    } // namespace detail
+
+    // Clips a polygon to a convex window in O(n * m)
+    inline Polygon ClipConvex(const Polygon& polygon, const Polygon& window) {
+        Polygon result, scratch;
+        detail::ClipConvexInto(polygon, detail::CounterClockwise(window), result, scratch);
+        return result;
+    }
+
+    // Clips many polygons against one convex window, e.g. a map tile. Each worker keeps its own
+    // scratch buffer, so the only allocations are for the outputs.
+    template <exec::ExecutionPolicy P>
+    std::vector<Polygon> ClipConvex(const P& policy, const std::vector<Polygon>& polygons, const Polygon& window) {
+        const Polygon ccw_window = detail::CounterClockwise(window);
+        std::vector<Polygon> result(polygons.size());
+        exec::ForEachBlock(policy, polygons.size(), 1 << 10, [&](const size_t begin, const size_t end) {
+            Polygon clipped, scratch;
+            for (size_t i = begin; i < end; i++) {
+                detail::ClipConvexInto(polygons[i], ccw_window, clipped, scratch);
+                result[i].assign(clipped.begin(), clipped.end());
+            }
+        });
+        return result;
+    }
+
+    // Boolean operation on two simple polygons. Outer boundaries of the result are counter-clockwise
+    // and holes clockwise, so summing SignedArea2 gives the area of the result. Inputs where a
+    // vertex touches the other boundary are perturbed by a small fraction of their extent.
+    inline std::vector<Polygon> PolygonBoolean(const Polygon& subject, const Polygon& clip, const BooleanOperation op) {
+        if (subject.size() < 3 || clip.size() < 3) throw std::runtime_error("Require polygons with at least three vertices");
+
+        const Polygon ccw_subject = detail::CounterClockwise(subject);
+        Polygon ccw_clip = detail::CounterClockwise(clip);
+
+        // Perturbation step: a small fraction of the combined bounding box, and at least a few
+        // float steps at the magnitude of the coordinates so it still moves far from the origin
+        math::Point2f low = ccw_subject[0], high = ccw_subject[0];
+        for (const Polygon* polygon : {&ccw_subject, static_cast<const Polygon*>(&ccw_clip)}) {
+            for (const auto& p : *polygon) {
+                low = {std::min(low.x(), p.x()), std::min(low.y(), p.y())};
+                high = {std::max(high.x(), p.x()), std::max(high.y(), p.y())};
+            }
+        }
+        const float size = std::max(high.x() - low.x(), high.y() - low.y());
+        const float magnitude = std::max({std::abs(low.x()), std::abs(low.y()), std::abs(high.x()), std::abs(high.y())});
+        const float step = std::max(size * 1e-5f, magnitude * 16 * std::numeric_limits<float>::epsilon());
+        const math::Vector2f nudge {0.7548777f, 0.5698403f};
+
+        constexpr int kMaxPerturbations = 8;
+        detail::BooleanTracer tracer;
+        for (int attempt = 0; !tracer.Build(ccw_subject, ccw_clip); attempt++) {
+            if (attempt == kMaxPerturbations) throw std::runtime_error("Could not resolve degenerate polygon intersection");
+            for (auto& p : ccw_clip) p = detail::Advance(p, nudge, step);
+        }
+
+        if (tracer.Crossings() == 0) return detail::NestedBoolean(ccw_subject, ccw_clip, op);
+        auto result = tracer.Trace(ccw_subject, ccw_clip, op);
+        detail::OrientRings(result);
+        return result;
+    }
+}
+} // namespace geom
+
+#endif // CPPGEOMETRY_POLYGON_CLIP_HPP
@@ -0,0 +1,141 @@
+//
+// Created by aamalh on 01/02/26.
+//
+
+#ifndef CPPGEOMETRY_ROTATING_CALIPERS_HPP
+#define CPPGEOMETRY_ROTATING_CALIPERS_HPP
+
+#include <array>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+#include "../math/GeomUtils.hpp"
+#include "../math/Point.hpp"
+#include "PointPair.hpp"
+
+// All routines in this file expect the output of ConvexHull2D: the vertices of a convex polygon in
+// counter-clockwise order. The closing vertex that ConvexHull2D repeats at the end is optional.
+namespace geom {
+namespace alg {
+    struct Rectangle {
+        // Corners in counter-clockwise order
+        std::array<math::Point2f, 4> corners;
+        float area;
+        float perimeter;
+    };
+
+    namespace detail {
+        // Number of distinct vertices, ignoring the repeated closing vertex of ConvexHull2D
+        inline size_t HullSize(const std::vector<math::Point2f>& hull) {
+            if (hull.empty()) throw std::runtime_error("Require a non-empty hull");
+            if (hull.size() > 1 && hull.front() == hull.back()) return hull.size() - 1;
+            return hull.size();
+        }
+
+        // Advance the caliper on the vertex that is farthest from the line through the given edge
+        inline size_t AdvanceAntipodal(const std::vector<math::Point2f>& hull, const size_t n,
+                                       const math::Vector2f& edge, size_t j) {
+            while (math::Cross2D(edge, hull[(j + 1) % n] - hull[j]) > 0) j = (j + 1) % n;
+            return j;
+        }
+
+        // Sweeps all edge-aligned bounding rectangles and keeps the one minimising `cost`
+        template <class Cost>
+        Rectangle MinimumRectangle(const std::vector<math::Point2f>& hull, Cost cost) {
+            const size_t n = HullSize(hull);
+            if (n < 3) throw std::runtime_error("Require at least three hull vertices for a bounding rectangle");
+
+            Rectangle best {};
+            float best_cost = std::numeric_limits<float>::max();
+            size_t top = 0, right = 0, left = 0;
+            for (size_t i = 0; i < n; i++) {
+                const math::Point2f& base = hull[i];
+                const math::Vector2f u = (hull[(i + 1) % n] - base).Normalise();
+                const math::Vector2f normal {-u.y(), u.x()};
+
+                if (i == 0) right = 1;
+                while (math::Dot(u, hull[(right + 1) % n] - hull[right]) > 0) right = (right + 1) % n;
+                if (i == 0) top = right;
+                top = AdvanceAntipodal(hull, n, u, top);
+                if (i == 0) left = top;
+                while (math::Dot(u, hull[(left + 1) % n] - hull[left]) < 0) left = (left + 1) % n;
+
+                const float min_u = math::Dot(u, hull[left] - base);
+                const float max_u = math::Dot(u, hull[right] - base);
+                const float height = math::Cross2D(u, hull[top] - base);
+                const float width = max_u - min_u;
+
+                Rectangle rect {
+                    {
+                        base + u * min_u,
+                        base + u * max_u,
+                        base + u * max_u + normal * height,
+                        base + u * min_u + normal * height,
+                    },
+                    width * height,
+                    2 * (width + height)
+                };
+                if (const float c = cost(rect); c < best_cost) {
+                    best_cost = c;
+                    best = rect;
+                }
+            }
+            return best;
+        }
+    } // namespace detail
+
+    // Farthest pair of hull vertices in O(n)
+    inline PointPair Diameter(const std::vector<math::Point2f>& hull) {
+        const size_t n = detail::HullSize(hull);
+        PointPair best {hull[0], hull[0], 0};
+        if (n == 1) return best;
+
+        float best_sq = 0;
+        auto consider = [&best, &best_sq](const math::Point2f& a, const math::Point2f& b) {
+            if (const float d = math::SquaredDistance(a, b); d > best_sq) {
+                best_sq = d;
+                best.first = a;
+                best.second = b;
+            }
+        };
+
+        size_t j = 1;
+        for (size_t i = 0; i < n; i++) {
+            const size_t next = (i + 1) % n;
+            j = detail::AdvanceAntipodal(hull, n, hull[next] - hull[i], j);
+            consider(hull[i], hull[j]);
+            consider(hull[next], hull[j]);
+        }
+        best.distance = std::sqrt(best_sq);
+        return best;
+    }
+
+    // Smallest distance between two parallel lines enclosing the hull in O(n)
+    inline float MinimumWidth(const std::vector<math::Point2f>& hull) {
+        const size_t n = detail::HullSize(hull);
+        if (n < 3) return 0;
+
+        float width = std::numeric_limits<float>::max();
+        size_t j = 1;
+        for (size_t i = 0; i < n; i++) {
+            const math::Vector2f edge = hull[(i + 1) % n] - hull[i];
+            j = detail::AdvanceAntipodal(hull, n, edge, j);
+            width = std::min(width, math::Cross2D(edge, hull[j] - hull[i]) / edge.Norm());
+        }
+        return width;
+    }
+
+    // The optimal enclosing rectangle always has a side collinear with a hull edge, so both
+    // of these sweep the n edge-aligned rectangles with three calipers in O(n)
+    inline Rectangle MinimumAreaRectangle(const std::vector<math::Point2f>& hull) {
+        return detail::MinimumRectangle(hull, [](const Rectangle& r) { return r.area; });
+    }
+
+    inline Rectangle MinimumPerimeterRectangle(const std::vector<math::Point2f>& hull) {
+        return detail::MinimumRectangle(hull, [](const Rectangle& r) { return r.perimeter; });
+    }
+}
+} // namespace geom
+
+#endif // CPPGEOMETRY_ROTATING_CALIPERS_HPP
@@ -0,0 +1,82 @@
+//
+// Created by aamalh on 01/02/26.
+//
+
+#ifndef CPPGEOMETRY_SEGMENT_INTERSECTION_HPP
+#define CPPGEOMETRY_SEGMENT_INTERSECTION_HPP
+
+#include <algorithm>
+#include <mutex>
+#include <vector>
+
+#include "../exec/Policy.hpp"
+#include "../math/GeomUtils.hpp"
+#include "../math/Line.hpp"
+#include "../math/Point.hpp"
+
+namespace geom {
+namespace alg {
+    namespace detail {
+        template <math::EvaluationType Eval, std::floating_point T>
+        math::Vector<T, 2> CrossingPoint(const math::Line<T, 2>& a, const math::Line<T, 2>& b) {
+            using E = math::Evaluation<Eval, T>;
+            // Directions are taken in E, not with GetDir, which would subtract in T
+            const auto &a0 = a.GetOrigin(), &a1 = a.GetDest(), &b0 = b.GetOrigin(), &b1 = b.GetDest();
+            const E dir_a_x = static_cast<E>(a1.x()) - a0.x(), dir_a_y = static_cast<E>(a1.y()) - a0.y();
+            const E dir_b_x = static_cast<E>(b1.x()) - b0.x(), dir_b_y = static_cast<E>(b1.y()) - b0.y();
+            const E cross = dir_a_x * dir_b_y - dir_a_y * dir_b_x;
+            if (!math::IsEqual(cross, E {0})) return math::GetIntersection<Eval>(a, b);
+            // Collinear overlap, report an endpoint that lies on both segments
+            if (a.template Contains<Eval>(b.GetOrigin())) return b.GetOrigin();
+            if (a.template Contains<Eval>(b.GetDest())) return b.GetDest();
+            return a.GetOrigin();
+        }
+    } // namespace detail
+
+    // Crossing points of every intersecting pair of segments, in no particular order. Segments are
+    // swept by their leftmost x, so each is only tested against those whose x-extent overlaps its own.
+    // Eval is the type the predicates are evaluated in, as for ConvexHull2D.
+    template <math::EvaluationType Eval = void, exec::ExecutionPolicy P, std::floating_point T = float>
+    std::vector<math::Vector<T, 2>> SegmentIntersections(const P& policy, const std::vector<math::Line<T, 2>>& lines) {
+        struct Extent {
+            T min_x, max_x, min_y, max_y;
+            size_t index;
+        };
+        std::vector<Extent> extents;
+        extents.reserve(lines.size());
+        for (size_t i = 0; i < lines.size(); i++) {
+            const auto& o = lines[i].GetOrigin();
+            const auto& d = lines[i].GetDest();
+            extents.push_back({std::min(o.x(), d.x()), std::max(o.x(), d.x()),
+                               std::min(o.y(), d.y()), std::max(o.y(), d.y()), i});
+        }
+        exec::Sort(policy, extents.begin(), extents.end(),
+                   [](const Extent& a, const Extent& b) { return a.min_x < b.min_x; });
+
+        std::mutex mutex;
+        std::vector<math::Vector<T, 2>> result;
+        exec::ForEachBlock(policy, extents.size(), 1 << 10, [&](const size_t begin, const size_t end) {
+            std::vector<math::Vector<T, 2>> found;
+            for (size_t i = begin; i < end; i++) {
+                const Extent& a = extents[i];
+                for (size_t j = i + 1; j < extents.size() && extents[j].min_x <= a.max_x; j++) {
+                    const Extent& b = extents[j];
+                    if (b.min_y > a.max_y || b.max_y < a.min_y) continue;
+                    if (!lines[a.index].template Intersects<Eval>(lines[b.index])) continue;
+                    found.push_back(detail::CrossingPoint<Eval>(lines[a.index], lines[b.index]));
+                }
+            }
+            std::lock_guard lock(mutex);
+            result.insert(result.end(), found.begin(), found.end());
+        });
+        return result;
+    }
+
+    template <math::EvaluationType Eval = void, std::floating_point T = float>
+    std::vector<math::Vector<T, 2>> SegmentIntersections(const std::vector<math::Line<T, 2>>& lines) {
+        return SegmentIntersections<Eval>(exec::seq, lines);
+    }
+}
+} // namespace geom
+
+#endif // CPPGEOMETRY_SEGMENT_INTERSECTION_HPP
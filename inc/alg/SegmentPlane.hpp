@@ -0,0 +1,170 @@
+//
+// Created by aamalh on 01/02/26.
+//
+
+#ifndef CPPGEOMETRY_SEGMENT_PLANE_HPP
+#define CPPGEOMETRY_SEGMENT_PLANE_HPP
+
+#include <algorithm>
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+#include "../exec/Policy.hpp"
+#include "../math/Line.hpp"
+#include "../math/Plane.hpp"
+#include "../math/Point.hpp"
+
+// Segment-plane intersection for slicing meshes into contour layers. An endpoint exactly on the
+// plane counts as being on its positive side, so a segment crosses when its endpoints are
+// strictly on opposite sides and a mesh vertex on the plane is reported by exactly one of the
+// two edges meeting there on either side.
+namespace geom {
+namespace alg {
+    // Segments stored as structure of arrays so the batch kernels compile to packed SIMD loads
+    struct SegmentBatch {
+        std::vector<float> x0, y0, z0;
+        std::vector<float> x1, y1, z1;
+
+        SegmentBatch() = default;
+
+        explicit SegmentBatch(const std::vector<math::Line<float, 3>>& lines) {
+            Reserve(lines.size());
+            for (const auto& line : lines) Add(line.GetOrigin(), line.GetDest());
+        }
+
+        void Reserve(const size_t n) {
+            for (auto* v : {&x0, &y0, &z0, &x1, &y1, &z1}) v->reserve(n);
+        }
+
+        void Add(const math::Point3f& origin, const math::Point3f& dest) {
+            x0.push_back(origin.x());
+            y0.push_back(origin.y());
+            z0.push_back(origin.z());
+            x1.push_back(dest.x());
+            y1.push_back(dest.y());
+            z1.push_back(dest.z());
+        }
+
+        [[nodiscard]] size_t Size() const {
+            return x0.size();
+        }
+    };
+
+    // Per-segment results of intersecting a SegmentBatch with one plane. `t` and the point are
+    // computed for every segment but only meaningful where `hit` is set.
+    struct PlaneHits {
+        std::vector<float> t;
+        std::vector<float> x, y, z;
+        std::vector<uint8_t> hit;
+
+        explicit PlaneHits(const size_t n = 0) : t(n), x(n), y(n), z(n), hit(n) {}
+
+        void Resize(const size_t n) {
+            for (auto* v : {&t, &x, &y, &z}) v->resize(n);
+            hit.resize(n);
+        }
+
+        [[nodiscard]] size_t Count() const {
+            return std::ranges::count(hit, uint8_t {1});
+        }
+    };
+
+    // Parameter t in [0, 1) of the crossing point origin + dir * t, if the segment crosses the plane
+    inline std::optional<float> IntersectPlane(const math::Line<float, 3>& segment, const math::Plane& plane) {
+        const float d0 = math::Dot(plane.GetNormal(), segment.GetOrigin()) - plane.GetD();
+        const float d1 = math::Dot(plane.GetNormal(), segment.GetDest()) - plane.GetD();
+        if ((d0 < 0) == (d1 < 0)) return std::nullopt;
+        return d0 / (d0 - d1);
+    }
+
+    namespace detail {
+        // Branch-free so that GCC and Clang vectorise it at -O3. The pointers are parameters
+        // because GCC only honours __restrict there, and without it the loop is versioned on more
+        // alias checks than it is willing to emit.
+        inline void IntersectPlaneKernel(const size_t n, const float nx, const float ny, const float nz, const float d,
+                                         const float* __restrict x0, const float* __restrict y0, const float* __restrict z0,
+                                         const float* __restrict x1, const float* __restrict y1, const float* __restrict z1,
+                                         float* __restrict t, float* __restrict x, float* __restrict y, float* __restrict z,
+                                         uint8_t* __restrict hit) {
+            for (size_t i = 0; i < n; i++) {
+                const float d0 = nx * x0[i] + ny * y0[i] + nz * z0[i] - d;
+                const float d1 = nx * x1[i] + ny * y1[i] + nz * z1[i] - d;
+                // Adding 1 to the denominator of segments parallel to the plane keeps t finite
+                // without a select, which GCC will not if-convert around a division
+                const float ti = d0 / (d0 - d1 + static_cast<float>(d0 == d1));
+                t[i] = ti;
+                x[i] = x0[i] + (x1[i] - x0[i]) * ti;
+                y[i] = y0[i] + (y1[i] - y0[i]) * ti;
+                z[i] = z0[i] + (z1[i] - z0[i]) * ti;
+                hit[i] = (d0 < 0) != (d1 < 0);
+            }
+        }
+
+        inline void IntersectPlaneRange(const SegmentBatch& s, const math::Plane& plane, PlaneHits& out,
+                                        const size_t begin, const size_t end) {
+            const auto& normal = plane.GetNormal();
+            IntersectPlaneKernel(end - begin, normal.x(), normal.y(), normal.z(), plane.GetD(),
+                                 s.x0.data() + begin, s.y0.data() + begin, s.z0.data() + begin,
+                                 s.x1.data() + begin, s.y1.data() + begin, s.z1.data() + begin,
+                                 out.t.data() + begin, out.x.data() + begin, out.y.data() + begin,
+                                 out.z.data() + begin, out.hit.data() + begin);
+        }
+    } // namespace detail
+
+    // Intersects every segment with the plane, in parallel blocks under a parallel policy. Slicing
+    // loops should reuse `hits` between calls: at 10M segments, allocating and faulting in fresh
+    // output costs more than the kernel itself.
+    template <exec::ExecutionPolicy P>
+    void IntersectPlaneInto(const P& policy, const SegmentBatch& segments, const math::Plane& plane, PlaneHits& hits) {
+        hits.Resize(segments.Size());
+        exec::ForEachBlock(policy, segments.Size(), 1 << 16, [&](const size_t begin, const size_t end) {
+            detail::IntersectPlaneRange(segments, plane, hits, begin, end);
+        });
+    }
+
+    template <exec::ExecutionPolicy P>
+    PlaneHits IntersectPlane(const P& policy, const SegmentBatch& segments, const math::Plane& plane) {
+        PlaneHits hits;
+        IntersectPlaneInto(policy, segments, plane, hits);
+        return hits;
+    }
+
+    inline PlaneHits IntersectPlane(const SegmentBatch& segments, const math::Plane& plane) {
+        return IntersectPlane(exec::seq, segments, plane);
+    }
+
+    // Fills one PlaneHits per plane, e.g. every layer of a slicing job. Segments are streamed in
+    // cache-sized tiles and each tile is tested against all planes before moving on, so the
+    // input is read from memory once rather than once per plane.
+    template <exec::ExecutionPolicy P>
+    void IntersectPlanesInto(const P& policy, const SegmentBatch& segments, const std::vector<math::Plane>& planes,
+                             std::vector<PlaneHits>& hits) {
+        constexpr size_t kTile = 1 << 12;
+        hits.resize(planes.size());
+        for (auto& h : hits) h.Resize(segments.Size());
+        exec::ForEachBlock(policy, segments.Size(), 1 << 16, [&](const size_t begin, const size_t end) {
+            for (size_t tile = begin; tile < end; tile += kTile) {
+                const size_t tile_end = std::min(tile + kTile, end);
+                for (size_t p = 0; p < planes.size(); p++) {
+                    detail::IntersectPlaneRange(segments, planes[p], hits[p], tile, tile_end);
+                }
+            }
+        });
+    }
+
+    template <exec::ExecutionPolicy P>
+    std::vector<PlaneHits> IntersectPlanes(const P& policy, const SegmentBatch& segments,
+                                           const std::vector<math::Plane>& planes) {
+        std::vector<PlaneHits> hits;
+        IntersectPlanesInto(policy, segments, planes, hits);
+        return hits;
+    }
+
+    inline std::vector<PlaneHits> IntersectPlanes(const SegmentBatch& segments, const std::vector<math::Plane>& planes) {
+        return IntersectPlanes(exec::seq, segments, planes);
+    }
+}
+} // namespace geom
+
+#endif // CPPGEOMETRY_SEGMENT_PLANE_HPP
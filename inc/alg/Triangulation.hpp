@@ -0,0 +1,335 @@
+//
+// Created by aamalh on 01/02/26.
+//
+
+#ifndef CPPGEOMETRY_TRIANGULATION_HPP
+#define CPPGEOMETRY_TRIANGULATION_HPP
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <set>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "../exec/Policy.hpp"
+#include "../math/GeomUtils.hpp"
+#include "../math/Point.hpp"
+#include "PolygonClip.hpp"
+
+namespace geom {
+namespace alg {
+    // Indices into the input polygon, counter-clockwise
+    typedef std::array<uint32_t, 3> Triangle;
+
+    namespace detail {
+        enum class VertexType {
+            START,
+            END,
+            SPLIT,
+            MERGE,
+            REGULAR
+        };
+
+        // Splits a counter-clockwise simple polygon into y-monotone pieces with a top-to-bottom
+        // sweep (de Berg et al., ch. 3), then triangulates each piece in linear time
+        class MonotoneTriangulator {
+            const Polygon& _points;
+            const size_t _n;
+            std::vector<VertexType> _types;
+            std::vector<std::pair<size_t, size_t>> _diagonals;
+
+            [[nodiscard]] size_t Prev_(const size_t i) const {
+                return (i + _n - 1) % _n;
+            }
+
+            [[nodiscard]] size_t Next_(const size_t i) const {
+                return (i + 1) % _n;
+            }
+
+            // Sweep order: higher y first, ties broken by smaller x
+            [[nodiscard]] bool Above_(const size_t a, const size_t b) const {
+                const auto& p = _points[a];
+                const auto& q = _points[b];
+                return p.y() > q.y() || (p.y() == q.y() && p.x() < q.x());
+            }
+
+            // Twice the signed area of abc, from raw coordinate differences in double. Its exact
+            // sign decides turns; Orientation2d's absolute tolerance would take every turn of a
+            // polygon a few thousandths across for collinear.
+            [[nodiscard]] double Turn_(const size_t a, const size_t b, const size_t c) const {
+                const auto& p = _points[a];
+                const auto& q = _points[b];
+                const auto& r = _points[c];
+                return (static_cast<double>(q.x()) - p.x()) * (static_cast<double>(r.y()) - p.y())
+                       - (static_cast<double>(q.y()) - p.y()) * (static_cast<double>(r.x()) - p.x());
+            }
+
+            void Classify_() {
+                _types.resize(_n);
+                for (size_t i = 0; i < _n; i++) {
+                    const bool prev_below = Above_(i, Prev_(i));
+                    const bool next_below = Above_(i, Next_(i));
+                    const bool reflex = Turn_(Prev_(i), i, Next_(i)) < 0;
+                    if (prev_below && next_below) _types[i] = reflex ? VertexType::SPLIT : VertexType::START;
+                    else if (!prev_below && !next_below) _types[i] = reflex ? VertexType::MERGE : VertexType::END;
+                    else _types[i] = VertexType::REGULAR;
+                }
+            }
+
+            // Status of the sweep: the edges (i, i + 1) with the interior to their right, ordered by
+            // where they cross the sweep line. Edges in the status never cross, so the order is stable.
+            struct EdgeLess {
+                using is_transparent = void;
+                const MonotoneTriangulator* self;
+                const double* sweep_y;
+
+                [[nodiscard]] double XAt(const size_t edge) const {
+                    const auto& a = self->_points[edge];
+                    const auto& b = self->_points[self->Next_(edge)];
+                    if (a.y() == b.y()) return std::min(a.x(), b.x());
+                    return a.x() + (*sweep_y - a.y()) * (static_cast<double>(b.x()) - a.x()) / (b.y() - a.y());
+                }
+
+                bool operator()(const size_t a, const size_t b) const {
+                    if (a == b) return false;
+                    const double xa = XAt(a), xb = XAt(b);
+                    return xa != xb ? xa < xb : a < b;
+                }
+                bool operator()(const size_t a, const double x) const { return XAt(a) < x; }
+                bool operator()(const double x, const size_t b) const { return x < XAt(b); }
+            };
+
+            void Sweep_() {
+                std::vector<size_t> order(_n);
+                for (size_t i = 0; i < _n; i++) order[i] = i;
+                std::ranges::sort(order, [this](const size_t a, const size_t b) { return Above_(a, b); });
+
+                double sweep_y = 0;
+                std::set<size_t, EdgeLess> status(EdgeLess {this, &sweep_y});
+                std::vector<std::set<size_t, EdgeLess>::iterator> in_status(_n, status.end());
+                std::vector<size_t> helper(_n);
+
+                auto insert = [&](const size_t edge, const size_t v) {
+                    in_status[edge] = status.insert(edge).first;
+                    helper[edge] = v;
+                };
+                auto remove = [&](const size_t edge) {
+                    status.erase(in_status[edge]);
+                    in_status[edge] = status.end();
+                };
+                auto connect_merge_helper = [&](const size_t edge, const size_t v) {
+                    if (_types[helper[edge]] == VertexType::MERGE) _diagonals.emplace_back(v, helper[edge]);
+                };
+                // Edge immediately left of v on the sweep line
+                auto left_of = [&](const size_t v) {
+                    auto it = status.lower_bound(static_cast<double>(_points[v].x()));
+                    if (it == status.begin()) throw std::runtime_error("Polygon is not simple");
+                    return *--it;
+                };
+
+                for (const size_t v : order) {
+                    sweep_y = _points[v].y();
+                    const size_t prev_edge = Prev_(v);
+                    switch (_types[v]) {
+                    case VertexType::START:
+                        insert(v, v);
+                        break;
+                    case VertexType::END:
+                        connect_merge_helper(prev_edge, v);
+                        remove(prev_edge);
+                        break;
+                    case VertexType::SPLIT: {
+                        const size_t left = left_of(v);
+                        _diagonals.emplace_back(v, helper[left]);
+                        helper[left] = v;
+                        insert(v, v);
+                        break;
+                    }
+                    case VertexType::MERGE: {
+                        connect_merge_helper(prev_edge, v);
+                        remove(prev_edge);
+                        const size_t left = left_of(v);
+                        connect_merge_helper(left, v);
+                        helper[left] = v;
+                        break;
+                    }
+                    case VertexType::REGULAR:
+                        if (Above_(Prev_(v), v)) {
+                            // Left boundary, the interior lies to the right of v
+                            connect_merge_helper(prev_edge, v);
+                            remove(prev_edge);
+                            insert(v, v);
+                        } else {
+                            const size_t left = left_of(v);
+                            connect_merge_helper(left, v);
+                            helper[left] = v;
+                        }
+                        break;
+                    }
+                }
+            }
+
+            // Faces of the polygon edges plus diagonals, each as counter-clockwise vertex indices.
+            // At every vertex the outgoing edges are sorted by angle, and a face is followed by
+            // leaving each vertex on the edge clockwise-adjacent to the one it was entered by.
+            [[nodiscard]] std::vector<std::vector<size_t>> Pieces_() const {
+                std::vector<std::vector<size_t>> adjacent(_n);
+                for (size_t i = 0; i < _n; i++) adjacent[i] = {Prev_(i), Next_(i)};
+                for (const auto& [a, b] : _diagonals) {
+                    adjacent[a].push_back(b);
+                    adjacent[b].push_back(a);
+                }
+                for (size_t v = 0; v < _n; v++) {
+                    auto angle = [this, v](const size_t w) {
+                        return std::atan2(static_cast<double>(_points[w].y()) - _points[v].y(),
+                                          static_cast<double>(_points[w].x()) - _points[v].x());
+                    };
+                    std::ranges::sort(adjacent[v], [&angle](const size_t a, const size_t b) { return angle(a) < angle(b); });
+                }
+
+                std::vector<std::vector<bool>> visited(_n);
+                for (size_t v = 0; v < _n; v++) {
+                    visited[v].resize(adjacent[v].size());
+                    // Boundary edges walked backwards belong to the outer face
+                    for (size_t k = 0; k < adjacent[v].size(); k++) {
+                        if (adjacent[v][k] == Prev_(v)) visited[v][k] = true;
+                    }
+                }
+
+                std::vector<std::vector<size_t>> pieces;
+                for (size_t start = 0; start < _n; start++) {
+                    for (size_t k = 0; k < adjacent[start].size(); k++) {
+                        if (visited[start][k]) continue;
+                        std::vector<size_t> piece;
+                        size_t u = start, edge = k;
+                        while (!visited[u][edge]) {
+                            visited[u][edge] = true;
+                            piece.push_back(u);
+                            const size_t v = adjacent[u][edge];
+                            const auto& around = adjacent[v];
+                            const size_t back = std::ranges::find(around, u) - around.begin();
+                            edge = (back + around.size() - 1) % around.size();
+                            u = v;
+                        }
+                        pieces.push_back(std::move(piece));
+                    }
+                }
+                return pieces;
+            }
+
+            void Emit_(std::vector<Triangle>& out, const size_t a, size_t b, size_t c) const {
+                if (Turn_(a, b, c) < 0) std::swap(b, c);
+                out.push_back({static_cast<uint32_t>(a), static_cast<uint32_t>(b), static_cast<uint32_t>(c)});
+            }
+
+            // Linear-time triangulation of a y-monotone piece: the two chains are merged in sweep
+            // order and the stack holds a reflex chain still waiting for diagonals
+            void TriangulateMonotone_(const std::vector<size_t>& piece, std::vector<Triangle>& out) const {
+                const size_t m = piece.size();
+                if (m < 3) return;
+                if (m == 3) {
+                    Emit_(out, piece[0], piece[1], piece[2]);
+                    return;
+                }
+
+                size_t top = 0, bottom = 0;
+                for (size_t i = 1; i < m; i++) {
+                    if (Above_(piece[i], piece[top])) top = i;
+                    if (Above_(piece[bottom], piece[i])) bottom = i;
+                }
+
+                // Counter-clockwise from the top descends the left chain, clockwise the right chain
+                struct Entry {
+                    size_t vertex;
+                    bool left;
+                };
+                std::vector<Entry> sorted;
+                sorted.reserve(m);
+                sorted.push_back({piece[top], true});
+                size_t l = (top + 1) % m, r = (top + m - 1) % m;
+                while (sorted.size() < m) {
+                    const bool take_left = r == bottom || (l != (bottom + 1) % m && Above_(piece[l], piece[r]));
+                    if (take_left) {
+                        sorted.push_back({piece[l], true});
+                        l = (l + 1) % m;
+                    } else {
+                        sorted.push_back({piece[r], false});
+                        r = (r + m - 1) % m;
+                    }
+                }
+
+                std::vector<Entry> stack {sorted[0], sorted[1]};
+                for (size_t j = 2; j + 1 < m; j++) {
+                    const Entry& u = sorted[j];
+                    if (u.left != stack.back().left) {
+                        for (size_t i = 0; i + 1 < stack.size(); i++) Emit_(out, u.vertex, stack[i].vertex, stack[i + 1].vertex);
+                        const Entry last = stack.back();
+                        stack = {last, u};
+                    } else {
+                        Entry last = stack.back();
+                        stack.pop_back();
+                        // The diagonal to the next stacked vertex lies inside when the chain turns away from u
+                        auto inside = [&](const size_t w) {
+                            const double turn = Turn_(u.vertex, last.vertex, w);
+                            return u.left ? turn < 0 : turn > 0;
+                        };
+                        while (!stack.empty() && inside(stack.back().vertex)) {
+                            Emit_(out, u.vertex, last.vertex, stack.back().vertex);
+                            last = stack.back();
+                            stack.pop_back();
+                        }
+                        stack.push_back(last);
+                        stack.push_back(u);
+                    }
+                }
+                const size_t last = sorted[m - 1].vertex;
+                for (size_t i = 0; i + 1 < stack.size(); i++) Emit_(out, last, stack[i].vertex, stack[i + 1].vertex);
+            }
+
+        public:
+            explicit MonotoneTriangulator(const Polygon& ccw_points) : _points(ccw_points), _n(ccw_points.size()) {}
+
+            std::vector<Triangle> Run() {
+                Classify_();
+                Sweep_();
+                std::vector<Triangle> triangles;
+                triangles.reserve(_n - 2);
+                for (const auto& piece : Pieces_()) TriangulateMonotone_(piece, triangles);
+                return triangles;
+            }
+        };
+    } // namespace detail
+
+    // Triangulates a simple polygon without holes in O(n log n) by monotone decomposition. Returns
+    // n - 2 counter-clockwise triangles of indices into `polygon`, which may have either winding.
+    inline std::vector<Triangle> Triangulate(const Polygon& polygon) {
+        if (polygon.size() < 3) throw std::runtime_error("Require polygons with at least three vertices");
+        if (polygon.size() > std::numeric_limits<uint32_t>::max()) throw std::runtime_error("Polygon too large for 32-bit indices");
+
+        if (SignedArea2(polygon) >= 0) return detail::MonotoneTriangulator(polygon).Run();
+
+        // Triangulate the reversed polygon and map indices back
+        const uint32_t last = polygon.size() - 1;
+        const Polygon reversed(polygon.rbegin(), polygon.rend());
+        auto triangles = detail::MonotoneTriangulator(reversed).Run();
+        for (auto& t : triangles) t = {last - t[0], last - t[1], last - t[2]};
+        return triangles;
+    }
+
+    // Triangulates many polygons, e.g. every building outline in a tile
+    template <exec::ExecutionPolicy P>
+    std::vector<std::vector<Triangle>> Triangulate(const P& policy, const std::vector<Polygon>& polygons) {
+        std::vector<std::vector<Triangle>> result(polygons.size());
+        exec::ForEachBlock(policy, polygons.size(), 1 << 4, [&](const size_t begin, const size_t end) {
+            for (size_t i = begin; i < end; i++) result[i] = Triangulate(polygons[i]);
+        });
+        return result;
+    }
+}
+} // namespace geom
+
+#endif // CPPGEOMETRY_TRIANGULATION_HPP
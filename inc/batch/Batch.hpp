@@ -0,0 +1,248 @@
+#ifndef CPPGEOMETRY_BATCH_HPP
+#define CPPGEOMETRY_BATCH_HPP
+
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <filesystem>
+#include <iomanip>
+#include <optional>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "../alg/ClosestPair.hpp"
+#include "../alg/ConvexHull.hpp"
+#include "../alg/RotatingCalipers.hpp"
+#include "../alg/SegmentIntersection.hpp"
+#include "../math/Line.hpp"
+#include "../math/Point.hpp"
+
+// Everything geometry_batch does apart from HDF5 I/O, kept free of HighFive so it can be tested
+namespace geom::batch {
+    // Same on-disk layout as the Renderer: an N x 2 float dataset
+    typedef std::vector<std::array<float, 2>> PointList;
+
+    enum class Algorithm {
+        HULL,
+        INTERSECTION,
+        CLOSEST_PAIR,
+        DIAMETER,
+        MIN_AREA_RECTANGLE
+    };
+
+    inline constexpr std::array<std::pair<std::string_view, Algorithm>, 5> kAlgorithms {{
+        {"hull", Algorithm::HULL},
+        {"intersection", Algorithm::INTERSECTION},
+        {"closest-pair", Algorithm::CLOSEST_PAIR},
+        {"diameter", Algorithm::DIAMETER},
+        {"min-area-rectangle", Algorithm::MIN_AREA_RECTANGLE},
+    }};
+
+    inline std::optional<Algorithm> ParseAlgorithm(const std::string_view name) {
+        for (const auto& [key, algorithm] : kAlgorithms) {
+            if (key == name) return algorithm;
+        }
+        return std::nullopt;
+    }
+
+    inline std::string_view AlgorithmName(const Algorithm algorithm) {
+        for (const auto& [key, value] : kAlgorithms) {
+            if (value == algorithm) return key;
+        }
+        return "unknown";
+    }
+
+    inline std::vector<math::Point2f> ToPoints(const PointList& list) {
+        std::vector<math::Point2f> points;
+        points.reserve(list.size());
+        for (const auto& p : list) points.emplace_back(p[0], p[1]);
+        return points;
+    }
+
+    inline PointList ToList(const std::vector<math::Point2f>& points) {
+        PointList list;
+        list.reserve(points.size());
+        for (const auto& p : points) list.push_back({p.x(), p.y()});
+        return list;
+    }
+
+    // Segments are stored as consecutive point pairs, as in res/lines
+    inline std::vector<math::Line<float, 2>> ToLines(const PointList& list) {
+        std::vector<math::Line<float, 2>> lines;
+        lines.reserve(list.size() / 2);
+        for (size_t i = 0; i + 1 < list.size(); i += 2) {
+            lines.emplace_back(math::Point2f {list[i][0], list[i][1]}, math::Point2f {list[i + 1][0], list[i + 1][1]});
+        }
+        return lines;
+    }
+
+    // Smallest input each algorithm is defined on, in rows
+    inline size_t MinimumPoints(const Algorithm algorithm) {
+        switch (algorithm) {
+        case Algorithm::INTERSECTION:
+        case Algorithm::CLOSEST_PAIR:
+            return 2;
+        default:
+            return 3;
+        }
+    }
+
+    // Runs one algorithm on one dataset. Each file is already processed on its own pool thread,
+    // so the algorithms themselves run sequentially.
+    inline PointList Run(const Algorithm algorithm, const PointList& input) {
+        if (input.size() < MinimumPoints(algorithm)) {
+            throw std::runtime_error(std::string(AlgorithmName(algorithm)) + " needs at least "
+                                     + std::to_string(MinimumPoints(algorithm)) + " points, got "
+                                     + std::to_string(input.size()));
+        }
+        switch (algorithm) {
+        case Algorithm::HULL:
+            return ToList(alg::ConvexHull2D(ToPoints(input)));
+        case Algorithm::INTERSECTION:
+            return ToList(alg::SegmentIntersections(ToLines(input)));
+        case Algorithm::CLOSEST_PAIR: {
+            const auto pair = alg::ClosestPair(ToPoints(input));
+            return ToList({pair.first, pair.second});
+        }
+        case Algorithm::DIAMETER: {
+            const auto pair = alg::Diameter(alg::ConvexHull2D(ToPoints(input)));
+            return ToList({pair.first, pair.second});
+        }
+        case Algorithm::MIN_AREA_RECTANGLE: {
+            const auto rect = alg::MinimumAreaRectangle(alg::ConvexHull2D(ToPoints(input)));
+            return ToList({rect.corners.begin(), rect.corners.end()});
+        }
+        }
+        throw std::invalid_argument("Unknown algorithm");
+    }
+
+    struct Options {
+        Algorithm algorithm = Algorithm::HULL;
+        // Read from every input, "points" when none are given
+        std::vector<std::string> datasets;
+        std::filesystem::path output_dir;
+        size_t jobs = 0;
+        // Persists results across runs when set, see cache::Hdf5Store
+        std::filesystem::path cache_file;
+        std::vector<std::filesystem::path> inputs;
+    };
+
+    inline constexpr std::string_view kUsage =
+        "usage: geometry_batch --algorithm <name> [--dataset <name>]... [--output-dir <dir>] [--jobs <n>]\n"
+        "                      [--cache <cache.h5>] <file.h5>...\n"
+        "  algorithms: hull, intersection, closest-pair, diameter, min-area-rectangle\n"
+        "  results are written to <output-dir>/<stem>_<algorithm>.h5, next to the input by default,\n"
+        "  or <stem>_<dataset>_<algorithm>.h5 when several datasets are given\n";
+
+    inline Options ParseArgs(const std::vector<std::string_view>& args) {
+        Options options;
+        bool has_algorithm = false;
+        for (size_t i = 0; i < args.size(); i++) {
+            const std::string_view arg = args[i];
+            auto value = [&]() -> std::string_view {
+                if (i + 1 >= args.size()) throw std::invalid_argument(std::string("Missing value for ") + std::string(arg));
+                return args[++i];
+            };
+            if (arg == "--algorithm") {
+                const auto name = value();
+                const auto algorithm = ParseAlgorithm(name);
+                if (!algorithm) throw std::invalid_argument("Unknown algorithm " + std::string(name));
+                options.algorithm = *algorithm;
+                has_algorithm = true;
+            } else if (arg == "--dataset") {
+                options.datasets.emplace_back(value());
+            } else if (arg == "--output-dir") {
+                options.output_dir = value();
+            } else if (arg == "--jobs") {
+                // Parsed signed and in full, so "-1" and "4x" are rejected rather than wrapped or truncated
+                const auto text = value();
+                long long jobs = 0;
+                const auto [end, error] = std::from_chars(text.data(), text.data() + text.size(), jobs);
+                if (error != std::errc {} || end != text.data() + text.size() || jobs <= 0)
+                    throw std::invalid_argument("Invalid value for --jobs: " + std::string(text));
+                options.jobs = static_cast<size_t>(jobs);
+            } else if (arg == "--cache") {
+                options.cache_file = value();
+            } else if (arg.starts_with("--")) {
+                throw std::invalid_argument("Unknown option " + std::string(arg));
+            } else {
+                options.inputs.emplace_back(arg);
+            }
+        }
+        if (!has_algorithm) throw std::invalid_argument("An --algorithm is required");
+        if (options.inputs.empty()) throw std::invalid_argument("At least one input file is required");
+        if (options.datasets.empty()) options.datasets.emplace_back("points");
+        return options;
+    }
+
+    // One dataset of one input file, and the file its result is written to
+    struct Job {
+        std::filesystem::path input;
+        std::string dataset;
+        std::filesystem::path output;
+    };
+
+    // One job per input and dataset. When two inputs share a stem and would write the same
+    // file, e.g. a/x.h5 and b/x.h5 under one --output-dir, the later ones get _2, _3... on the stem.
+    inline std::vector<Job> PlanJobs(const Options& options) {
+        const std::string algorithm(AlgorithmName(options.algorithm));
+        std::vector<Job> jobs;
+        std::vector<std::filesystem::path> taken;
+        for (const auto& input : options.inputs) {
+            for (const auto& dataset : options.datasets) {
+                const auto dir = options.output_dir.empty() ? input.parent_path() : options.output_dir;
+                const std::string suffix = (options.datasets.size() > 1 ? "_" + dataset : "") + "_" + algorithm + ".h5";
+                auto output = (dir / (input.stem().string() + suffix)).lexically_normal();
+                for (size_t n = 2; std::ranges::find(taken, output) != taken.end(); n++) {
+                    output = (dir / (input.stem().string() + "_" + std::to_string(n) + suffix)).lexically_normal();
+                }
+                taken.push_back(output);
+                jobs.push_back({input, dataset, output});
+            }
+        }
+        return jobs;
+    }
+
+    struct FileStats {
+        std::filesystem::path input;
+        // Set when several datasets are read from each file
+        std::string dataset;
+        size_t points = 0;
+        size_t results = 0;
+        double read_ms = 0;
+        double compute_ms = 0;
+        double write_ms = 0;
+        bool cached = false;
+        std::string error;
+
+        [[nodiscard]] double PointsPerSecond() const {
+            return compute_ms > 0 ? points / (compute_ms / 1e3) : 0;
+        }
+    };
+
+    inline void PrintStats(std::ostream& os, const std::vector<FileStats>& stats, const double wall_ms) {
+        size_t total_points = 0;
+        os << std::left << std::setw(32) << "file" << std::right << std::setw(12) << "points" << std::setw(10) << "results"
+           << std::setw(11) << "read ms" << std::setw(12) << "compute ms" << std::setw(11) << "write ms"
+           << std::setw(14) << "Mpts/s" << "\n";
+        for (const auto& s : stats) {
+            const std::string name = s.input.filename().string() + (s.dataset.empty() ? "" : ":" + s.dataset);
+            os << std::left << std::setw(32) << name << std::right;
+            if (!s.error.empty()) {
+                os << "  FAILED: " << s.error << "\n";
+                continue;
+            }
+            total_points += s.points;
+            os << std::setw(12) << s.points << std::setw(10) << s.results << std::fixed << std::setprecision(2)
+               << std::setw(11) << s.read_ms << std::setw(12) << s.compute_ms << std::setw(11) << s.write_ms
+               << std::setw(14) << s.PointsPerSecond() / 1e6 << (s.cached ? "  (cached)" : "") << "\n";
+        }
+        os << stats.size() << " files, " << total_points << " points in " << std::fixed << std::setprecision(2)
+           << wall_ms << " ms (" << (wall_ms > 0 ? total_points / (wall_ms / 1e3) / 1e6 : 0) << " Mpts/s overall)\n";
+    }
+} // namespace geom::batch
+
+#endif // CPPGEOMETRY_BATCH_HPP
@@ -0,0 +1,66 @@
+#ifndef CPPGEOMETRY_HASH_HPP
+#define CPPGEOMETRY_HASH_HPP
+
+#include <compare>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <string_view>
+#include <type_traits>
+
+namespace geom::cache {
+    namespace detail {
+        // Finaliser from MurmurHash3, a full-avalanche 64-bit mix
+        constexpr uint64_t Mix(uint64_t h) {
+            h ^= h >> 33;
+            h *= 0xff51afd7ed558ccdULL;
+            h ^= h >> 33;
+            h *= 0xc4ceb9fe1a85ec53ULL;
+            h ^= h >> 33;
+            return h;
+        }
+    } // namespace detail
+
+    // Non-cryptographic hash over raw bytes, eight at a time. Point clouds are hashed on every
+    // lookup, so this has to run close to memory bandwidth.
+    inline uint64_t HashBytes(const void* data, const size_t size, const uint64_t seed = 0) {
+        constexpr uint64_t kMultiplier = 0x9e3779b97f4a7c15ULL;
+        if (size == 0) return detail::Mix(seed ^ kMultiplier);
+        const auto* bytes = static_cast<const unsigned char*>(data);
+        uint64_t h = seed ^ (size * kMultiplier);
+        size_t i = 0;
+        for (; i + 8 <= size; i += 8) {
+            uint64_t word;
+            std::memcpy(&word, bytes + i, 8);
+            h = (h ^ detail::Mix(word)) * kMultiplier;
+        }
+        uint64_t tail = 0;
+        std::memcpy(&tail, bytes + i, size - i);
+        return detail::Mix(h ^ detail::Mix(tail ^ (size - i)));
+    }
+
+    template <class T> requires std::is_trivially_copyable_v<T>
+    uint64_t HashSpan(const std::span<const T> values, const uint64_t seed = 0) {
+        return HashBytes(values.data(), values.size_bytes(), seed);
+    }
+
+    // Identifies one input to the cache. `hash` picks the bucket; `check` is an independently
+    // seeded hash and `size` the input length in bytes, so a collision on `hash` alone is a miss.
+    struct CacheKey {
+        uint64_t hash = 0;
+        uint64_t check = 0;
+        uint64_t size = 0;
+
+        auto operator<=>(const CacheKey&) const = default;
+    };
+
+    // Cache key for running `algorithm` (its name plus any parameters) on `data`
+    template <class T> requires std::is_trivially_copyable_v<T>
+    CacheKey ResultKey(const std::string_view algorithm, const std::span<const T> data) {
+        constexpr uint64_t kCheckSeed = 0xc2b2ae3d27d4eb4fULL;
+        const uint64_t seed = HashBytes(algorithm.data(), algorithm.size());
+        return {HashSpan(data, seed), HashSpan(data, seed ^ kCheckSeed), data.size_bytes()};
+    }
+} // namespace geom::cache
+
+#endif // CPPGEOMETRY_HASH_HPP
@@ -0,0 +1,64 @@
+#ifndef CPPGEOMETRY_HDF5_STORE_HPP
+#define CPPGEOMETRY_HDF5_STORE_HPP
+
+#include <array>
+#include <cstdio>
+#include <filesystem>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <highfive/highfive.hpp>
+
+#include "ResultCache.hpp"
+
+namespace geom::cache {
+    // The stock HDF5 build is not thread-safe, so every HighFive call in the process should hold this
+    inline std::mutex& Hdf5Mutex() {
+        static std::mutex mutex;
+        return mutex;
+    }
+
+    // On-disk tier storing each N x 2 result in one HDF5 file, as a dataset named by the hex hash
+    // and check of its key, with the input size in an attribute that is compared on load
+    class Hdf5Store : public CacheStore<std::vector<std::array<float, 2>>> {
+        typedef std::vector<std::array<float, 2>> PointList;
+
+        std::filesystem::path _path;
+
+        static std::string Name_(const CacheKey& key) {
+            char name[33];
+            std::snprintf(name, sizeof(name), "%016llx%016llx", static_cast<unsigned long long>(key.hash),
+                          static_cast<unsigned long long>(key.check));
+            return name;
+        }
+
+    public:
+        explicit Hdf5Store(std::filesystem::path path) : _path(std::move(path)) {
+            std::lock_guard lock(Hdf5Mutex());
+            std::ignore = HighFive::File(_path.string(), HighFive::File::OpenOrCreate);
+        }
+
+        std::optional<PointList> Load(const CacheKey& key) override {
+            std::lock_guard lock(Hdf5Mutex());
+            const HighFive::File file(_path.string(), HighFive::File::ReadOnly);
+            const auto name = Name_(key);
+            if (!file.exist(name)) return std::nullopt;
+            const auto dataset = file.getDataSet(name);
+            if (!dataset.hasAttribute("input_bytes") || dataset.getAttribute("input_bytes").read<uint64_t>() != key.size) {
+                return std::nullopt;
+            }
+            return dataset.read<PointList>();
+        }
+
+        void Save(const CacheKey& key, const PointList& value) override {
+            std::lock_guard lock(Hdf5Mutex());
+            HighFive::File file(_path.string(), HighFive::File::ReadWrite);
+            const auto name = Name_(key);
+            if (file.exist(name)) return;
+            file.createDataSet(name, value).createAttribute("input_bytes", key.size);
+        }
+    };
+} // namespace geom::cache
+
+#endif // CPPGEOMETRY_HDF5_STORE_HPP
@@ -0,0 +1,131 @@
+#ifndef CPPGEOMETRY_RESULT_CACHE_HPP
+#define CPPGEOMETRY_RESULT_CACHE_HPP
+
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <unordered_map>
+#include <utility>
+
+#include "Hash.hpp"
+
+namespace geom::cache {
+    struct CacheStats {
+        size_t hits = 0;
+        size_t disk_hits = 0;
+        size_t misses = 0;
+        size_t evictions = 0;
+
+        [[nodiscard]] double HitRate() const {
+            const size_t lookups = hits + disk_hits + misses;
+            return lookups > 0 ? static_cast<double>(hits + disk_hits) / lookups : 0;
+        }
+    };
+
+    // Second tier behind the in-memory LRU, e.g. Hdf5Store
+    template <class Value>
+    class CacheStore {
+    public:
+        virtual ~CacheStore() = default;
+        virtual std::optional<Value> Load(const CacheKey& key) = 0;
+        virtual void Save(const CacheKey& key, const Value& value) = 0;
+    };
+
+    // Results keyed by hashes of their inputs (see ResultKey), held in a bounded LRU and
+    // optionally persisted to a CacheStore. Safe to share between threads; the lock is not
+    // held while computing, so two threads missing on the same key may both compute it.
+    template <class Value>
+    class ResultCache {
+        typedef std::list<std::pair<CacheKey, Value>> Entries;
+
+        struct KeyHash {
+            size_t operator()(const CacheKey& key) const { return key.hash; }
+        };
+
+        size_t _capacity;
+        std::shared_ptr<CacheStore<Value>> _store;
+        Entries _entries;
+        std::unordered_map<CacheKey, typename Entries::iterator, KeyHash> _index;
+        CacheStats _stats;
+        mutable std::mutex _mutex;
+
+        // Expects _mutex to be held
+        void Insert_(const CacheKey& key, Value value) {
+            if (const auto it = _index.find(key); it != _index.end()) {
+                it->second->second = std::move(value);
+                _entries.splice(_entries.begin(), _entries, it->second);
+                return;
+            }
+            _entries.emplace_front(key, std::move(value));
+            _index[key] = _entries.begin();
+            if (_entries.size() > _capacity) {
+                _index.erase(_entries.back().first);
+                _entries.pop_back();
+                _stats.evictions++;
+            }
+        }
+
+    public:
+        explicit ResultCache(const size_t capacity, std::shared_ptr<CacheStore<Value>> store = nullptr)
+            : _capacity(capacity), _store(std::move(store)) {
+            if (capacity == 0) throw std::runtime_error("Require a cache capacity of at least one entry");
+        }
+
+        std::optional<Value> Find(const CacheKey& key) {
+            {
+                std::lock_guard lock(_mutex);
+                if (const auto it = _index.find(key); it != _index.end()) {
+                    _entries.splice(_entries.begin(), _entries, it->second);
+                    _stats.hits++;
+                    return it->second->second;
+                }
+            }
+            if (_store) {
+                if (auto value = _store->Load(key)) {
+                    std::lock_guard lock(_mutex);
+                    _stats.disk_hits++;
+                    Insert_(key, *value);
+                    return value;
+                }
+            }
+            std::lock_guard lock(_mutex);
+            _stats.misses++;
+            return std::nullopt;
+        }
+
+        void Put(const CacheKey& key, Value value) {
+            if (_store) _store->Save(key, value);
+            std::lock_guard lock(_mutex);
+            Insert_(key, std::move(value));
+        }
+
+        template <class F>
+        Value GetOrCompute(const CacheKey& key, F&& compute) {
+            if (auto cached = Find(key)) return std::move(*cached);
+            Value value = compute();
+            Put(key, value);
+            return value;
+        }
+
+        [[nodiscard]] CacheStats Stats() const {
+            std::lock_guard lock(_mutex);
+            return _stats;
+        }
+
+        [[nodiscard]] size_t Size() const {
+            std::lock_guard lock(_mutex);
+            return _entries.size();
+        }
+
+        void Clear() {
+            std::lock_guard lock(_mutex);
+            _entries.clear();
+            _index.clear();
+        }
+    };
+} // namespace geom::cache
+
+#endif // CPPGEOMETRY_RESULT_CACHE_HPP
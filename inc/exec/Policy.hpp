@@ -0,0 +1,131 @@
+#ifndef CPPGEOMETRY_POLICY_HPP
+#define CPPGEOMETRY_POLICY_HPP
+
+#include <algorithm>
+#include <concepts>
+#include <iterator>
+#include <optional>
+#include <type_traits>
+
+#include "ThreadPool.hpp"
+
+// Execution policies for the algorithm layer, mirroring std::execution. Entry points take the
+// policy as their first parameter, e.g. ConvexHull2D(exec::par, points). Parallel policies run
+// on DefaultPool() unless bound to another pool with On().
+namespace geom::exec {
+    namespace detail {
+        inline PoolConfig& DefaultConfig() {
+            static PoolConfig config;
+            return config;
+        }
+
+        inline std::optional<ThreadPool>& DefaultStorage() {
+            static std::optional<ThreadPool> pool;
+            return pool;
+        }
+
+        inline std::mutex& DefaultMutex() {
+            static std::mutex mutex;
+            return mutex;
+        }
+    } // namespace detail
+
+    // Must be called before the default pool is first used
+    inline void ConfigureDefaultPool(const PoolConfig& config) {
+        std::lock_guard lock(detail::DefaultMutex());
+        if (detail::DefaultStorage().has_value()) {
+            throw std::runtime_error("Default thread pool is already running");
+        }
+        detail::DefaultConfig() = config;
+    }
+
+    inline ThreadPool& DefaultPool() {
+        std::lock_guard lock(detail::DefaultMutex());
+        auto& pool = detail::DefaultStorage();
+        if (!pool.has_value()) pool.emplace(detail::DefaultConfig());
+        return *pool;
+    }
+
+    struct SequencedPolicy {};
+
+    template <bool Unsequenced>
+    struct BasicParallelPolicy {
+        ThreadPool* pool = nullptr;
+
+        [[nodiscard]] BasicParallelPolicy On(ThreadPool& p) const {
+            return {&p};
+        }
+
+        [[nodiscard]] ThreadPool& Pool() const {
+            return pool ? *pool : DefaultPool();
+        }
+    };
+
+    using ParallelPolicy = BasicParallelPolicy<false>;
+    using ParallelUnsequencedPolicy = BasicParallelPolicy<true>;
+
+    inline constexpr SequencedPolicy seq {};
+    inline constexpr ParallelPolicy par {};
+    inline constexpr ParallelUnsequencedPolicy par_unseq {};
+
+    template <class P>
+    concept ParallelExecutionPolicy = std::same_as<std::remove_cvref_t<P>, ParallelPolicy>
+                                      || std::same_as<std::remove_cvref_t<P>, ParallelUnsequencedPolicy>;
+
+    template <class P>
+    concept ExecutionPolicy = std::same_as<std::remove_cvref_t<P>, SequencedPolicy> || ParallelExecutionPolicy<P>;
+
+    // Calls f(begin, end) on contiguous blocks of [0, n) of at least `grain` items
+    template <ExecutionPolicy P, class F>
+    void ForEachBlock(const P& policy, const size_t n, const size_t grain, F&& f) {
+        if constexpr (ParallelExecutionPolicy<P>) {
+            ThreadPool& pool = policy.Pool();
+            const size_t blocks = std::min(pool.Size() * 4, std::max<size_t>(1, n / std::max<size_t>(1, grain)));
+            if (blocks > 1) {
+                TaskGroup group(pool);
+                for (size_t b = 0; b < blocks; b++) {
+                    group.Run([&f, b, blocks, n] { f(b * n / blocks, (b + 1) * n / blocks); });
+                }
+                group.Wait();
+                return;
+            }
+        }
+        if (n > 0) f(size_t {0}, n);
+    }
+
+    // Sorts blocks concurrently, then merges adjacent runs pairwise in log(blocks) rounds
+    template <ExecutionPolicy P, std::random_access_iterator It, class Compare>
+    void Sort(const P& policy, It first, It last, Compare comp) {
+        constexpr size_t kMinParallel = 1 << 14;
+        const auto n = static_cast<size_t>(std::distance(first, last));
+        if constexpr (ParallelExecutionPolicy<P>) {
+            ThreadPool& pool = policy.Pool();
+            const size_t blocks = std::min(pool.Size(), n / kMinParallel);
+            if (blocks > 1) {
+                std::vector<It> bounds;
+                for (size_t b = 0; b <= blocks; b++) bounds.push_back(first + b * n / blocks);
+                {
+                    TaskGroup group(pool);
+                    for (size_t b = 0; b < blocks; b++) {
+                        group.Run([&bounds, &comp, b] { std::sort(bounds[b], bounds[b + 1], comp); });
+                    }
+                    group.Wait();
+                }
+                for (size_t width = 1; width < blocks; width *= 2) {
+                    TaskGroup group(pool);
+                    for (size_t b = 0; b + width < blocks; b += 2 * width) {
+                        const size_t end = std::min(b + 2 * width, blocks);
+                        group.Run([&bounds, &comp, b, width, end] {
+                            std::inplace_merge(bounds[b], bounds[b + width], bounds[end], comp);
+                        });
+                    }
+                    group.Wait();
+                }
+                return;
+            }
+        }
+        std::sort(first, last, comp);
+    }
+} // namespace geom::exec
+
+#endif // CPPGEOMETRY_POLICY_HPP
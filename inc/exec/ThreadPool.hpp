@@ -0,0 +1,214 @@
+#ifndef CPPGEOMETRY_THREAD_POOL_HPP
+#define CPPGEOMETRY_THREAD_POOL_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace geom::exec {
+    struct PoolConfig {
+        // Number of worker threads, zero picks the hardware concurrency
+        size_t threads = 0;
+        // CPUs the workers are pinned to, worker i runs on cpus[i % cpus.size()]. Empty leaves
+        // scheduling to the OS.
+        std::vector<int> cpus;
+    };
+
+    // Each worker owns a deque: it pushes and pops at the back, and idle workers steal from the
+    // front of the others, so recursively spawned tasks stay on the core that produced them.
+    class ThreadPool {
+        struct Queue {
+            std::mutex mutex;
+            std::deque<std::function<void()>> tasks;
+        };
+
+        std::vector<std::unique_ptr<Queue>> _queues;
+        std::vector<std::thread> _workers;
+        std::atomic<size_t> _pending {0};
+        std::atomic<size_t> _next {0};
+        std::mutex _sleep_mutex;
+        std::condition_variable _wake;
+        bool _stop = false;
+
+        inline static thread_local ThreadPool* tl_pool = nullptr;
+        inline static thread_local size_t tl_index = 0;
+
+        static void Pin_(std::thread& thread, const int cpu) {
+#ifdef __linux__
+            if (cpu < 0 || cpu >= CPU_SETSIZE) throw std::runtime_error("Worker CPU out of range");
+            cpu_set_t set;
+            CPU_ZERO(&set);
+            CPU_SET(cpu, &set);
+            if (pthread_setaffinity_np(thread.native_handle(), sizeof(set), &set) != 0) {
+                throw std::runtime_error("Failed to set worker CPU affinity");
+            }
+#else
+            std::ignore = thread;
+            std::ignore = cpu;
+#endif
+        }
+
+        bool Pop_(const size_t index, std::function<void()>& task) {
+            Queue& own = *_queues[index];
+            std::lock_guard lock(own.mutex);
+            if (own.tasks.empty()) return false;
+            task = std::move(own.tasks.back());
+            own.tasks.pop_back();
+            return true;
+        }
+
+        bool Steal_(const size_t index, std::function<void()>& task) {
+            for (size_t offset = 1; offset < _queues.size(); offset++) {
+                Queue& victim = *_queues[(index + offset) % _queues.size()];
+                std::lock_guard lock(victim.mutex);
+                if (victim.tasks.empty()) continue;
+                task = std::move(victim.tasks.front());
+                victim.tasks.pop_front();
+                return true;
+            }
+            return false;
+        }
+
+        void Run_(const size_t index) {
+            tl_pool = this;
+            tl_index = index;
+            while (true) {
+                if (TryRunOne()) continue;
+                std::unique_lock lock(_sleep_mutex);
+                _wake.wait(lock, [this] { return _stop || _pending > 0; });
+                if (_stop && _pending == 0) return;
+            }
+        }
+
+        void Stop_() {
+            {
+                std::lock_guard lock(_sleep_mutex);
+                _stop = true;
+            }
+            _wake.notify_all();
+            for (auto& worker : _workers) worker.join();
+        }
+
+    public:
+        explicit ThreadPool(const PoolConfig& config = {}) {
+            const size_t threads = config.threads > 0
+                                       ? config.threads
+                                       : std::max(1u, std::thread::hardware_concurrency());
+            for (size_t i = 0; i < threads; i++) _queues.push_back(std::make_unique<Queue>());
+            try {
+                for (size_t i = 0; i < threads; i++) {
+                    _workers.emplace_back([this, i] { Run_(i); });
+                    if (!config.cpus.empty()) Pin_(_workers.back(), config.cpus[i % config.cpus.size()]);
+                }
+            } catch (...) {
+                // The destructor will not run, and joinable threads would terminate the process
+                Stop_();
+                throw;
+            }
+        }
+
+        ThreadPool(const ThreadPool&) = delete;
+        ThreadPool& operator=(const ThreadPool&) = delete;
+
+        ~ThreadPool() {
+            Stop_();
+        }
+
+        // Queues on the calling worker's own deque, or round-robin when called from outside
+        void Push(std::function<void()> task) {
+            const size_t index = tl_pool == this ? tl_index : _next++ % _queues.size();
+            // Counted before it is visible so a thief can never take _pending below zero
+            _pending++;
+            {
+                std::lock_guard lock(_queues[index]->mutex);
+                _queues[index]->tasks.push_back(std::move(task));
+            }
+            {
+                std::lock_guard lock(_sleep_mutex);
+            }
+            _wake.notify_one();
+        }
+
+        template <class F>
+        auto Submit(F&& f) -> std::future<std::invoke_result_t<F>> {
+            auto task = std::make_shared<std::packaged_task<std::invoke_result_t<F>()>>(std::forward<F>(f));
+            auto future = task->get_future();
+            Push([task] { (*task)(); });
+            return future;
+        }
+
+        // Runs one queued task on the calling thread, used by waiters so they help rather than block
+        bool TryRunOne() {
+            const size_t index = tl_pool == this ? tl_index : 0;
+            std::function<void()> task;
+            if (!Pop_(index, task) && !Steal_(index, task)) return false;
+            _pending--;
+            task();
+            return true;
+        }
+
+        [[nodiscard]] size_t Size() const {
+            return _workers.size();
+        }
+    };
+
+    // Fork-join scope over a pool. Wait() executes queued work while it waits, so groups may
+    // be nested inside pool tasks without starving the workers.
+    class TaskGroup {
+        ThreadPool& _pool;
+        std::atomic<size_t> _outstanding {0};
+        std::mutex _error_mutex;
+        std::exception_ptr _error;
+
+    public:
+        explicit TaskGroup(ThreadPool& pool) : _pool(pool) {}
+
+        TaskGroup(const TaskGroup&) = delete;
+        TaskGroup& operator=(const TaskGroup&) = delete;
+
+        ~TaskGroup() {
+            while (_outstanding > 0) {
+                if (!_pool.TryRunOne()) std::this_thread::yield();
+            }
+        }
+
+        template <class F>
+        void Run(F&& f) {
+            _outstanding++;
+            _pool.Push([this, f = std::forward<F>(f)]() mutable {
+                try {
+                    f();
+                } catch (...) {
+                    std::lock_guard lock(_error_mutex);
+                    if (!_error) _error = std::current_exception();
+                }
+                _outstanding--;
+            });
+        }
+
+        void Wait() {
+            while (_outstanding > 0) {
+                if (!_pool.TryRunOne()) std::this_thread::yield();
+            }
+            if (_error) std::rethrow_exception(std::exchange(_error, nullptr));
+        }
+    };
+} // namespace geom::exec
+
+#endif // CPPGEOMETRY_THREAD_POOL_HPP
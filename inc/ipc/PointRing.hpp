@@ -0,0 +1,323 @@
+#ifndef CPPGEOMETRY_POINT_RING_HPP
+#define CPPGEOMETRY_POINT_RING_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <new>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "../math/Point.hpp"
+
+// Streaming points from another process on the same host through POSIX shared memory
+namespace geom::ipc {
+    // A named POSIX shared memory segment mapped into this process. The creator owns the name
+    // and unlinks it on destruction; openers only unmap.
+    class SharedMemory {
+        std::string _name;
+        void* _address = nullptr;
+        size_t _size = 0;
+        bool _owner = false;
+
+        SharedMemory(std::string name, const int flags, const size_t size, const bool owner)
+            : _name(std::move(name)), _owner(owner) {
+            const int fd = shm_open(_name.c_str(), flags, 0600);
+            if (fd < 0) throw std::runtime_error("Failed to open shared memory " + _name + ": " + std::strerror(errno));
+            struct stat status {};
+            if ((owner && ftruncate(fd, static_cast<off_t>(size)) != 0) || fstat(fd, &status) != 0) {
+                close(fd);
+                if (owner) shm_unlink(_name.c_str());
+                throw std::runtime_error("Failed to size shared memory " + _name);
+            }
+            _size = static_cast<size_t>(status.st_size);
+            _address = mmap(nullptr, _size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+            close(fd);
+            if (_address == MAP_FAILED) {
+                if (owner) shm_unlink(_name.c_str());
+                throw std::runtime_error("Failed to map shared memory " + _name);
+            }
+        }
+
+    public:
+        // Fails if the name is taken, so two consumers cannot share a segment by accident. A
+        // creator that dies without unwinding leaves the name behind (on Linux, under /dev/shm)
+        // until Unlink removes it.
+        static SharedMemory Create(std::string name, const size_t size) {
+            return {std::move(name), O_CREAT | O_EXCL | O_RDWR, size, true};
+        }
+
+        static SharedMemory Open(std::string name) {
+            return {std::move(name), O_RDWR, 0, false};
+        }
+
+        // Removes the name if it exists. Processes that still have it mapped keep their mapping,
+        // but a live creator and a new one would no longer share memory, so only use this on a
+        // name whose creator is known to be gone.
+        static void Unlink(const std::string& name) {
+            shm_unlink(name.c_str());
+        }
+
+        SharedMemory(SharedMemory&& other) noexcept
+            : _name(std::move(other._name)), _address(std::exchange(other._address, nullptr)),
+              _size(other._size), _owner(std::exchange(other._owner, false)) {}
+
+        SharedMemory& operator=(SharedMemory&& other) noexcept {
+            std::swap(_name, other._name);
+            std::swap(_address, other._address);
+            std::swap(_size, other._size);
+            std::swap(_owner, other._owner);
+            return *this;
+        }
+
+        SharedMemory(const SharedMemory&) = delete;
+        SharedMemory& operator=(const SharedMemory&) = delete;
+
+        ~SharedMemory() {
+            if (_address) munmap(_address, _size);
+            if (_owner) shm_unlink(_name.c_str());
+        }
+
+        [[nodiscard]] void* Data() const {
+            return _address;
+        }
+
+        [[nodiscard]] size_t Size() const {
+            return _size;
+        }
+    };
+
+    namespace detail {
+        inline constexpr uint64_t kRingMagic = 0x474e495254504750; // "PGPTRING"
+
+        // Lives at the start of the segment. The indices only ever grow and are reduced modulo
+        // the power of two capacity, so head == tail is empty and head - tail == capacity is
+        // full. Each index is written by one side only and sits on its own cache line.
+        struct RingHeader {
+            std::atomic<uint64_t> magic;
+            uint64_t capacity;
+            alignas(64) std::atomic<uint64_t> head;
+            alignas(64) std::atomic<uint64_t> tail;
+            alignas(64) std::atomic<uint32_t> closed;
+        };
+
+        static_assert(std::atomic<uint64_t>::is_always_lock_free && std::atomic<uint32_t>::is_always_lock_free,
+                      "Shared memory atomics have to be lock-free to work across processes");
+
+        inline constexpr size_t kRingData = (sizeof(RingHeader) + 63) / 64 * 64;
+
+        // Spins briefly, then yields, for the few microseconds a peer usually needs
+        class Backoff {
+            int _spins = 0;
+
+        public:
+            void Wait() {
+                if (_spins++ < 64) return;
+                std::this_thread::yield();
+            }
+        };
+    } // namespace detail
+
+    // Lock-free single-producer single-consumer ring of Point2f in shared memory. The consumer
+    // creates it and the producer opens it by name, usually from another process.
+    //
+    // Both sides work in place: the producer writes into spans of the ring returned by Reserve
+    // and publishes them with Commit, and the consumer reads spans returned by Peek and frees
+    // them with Release, so points are never staged through a private buffer. A full ring makes
+    // Reserve return nothing and Write wait, which holds the producer to the consumer's pace.
+    class PointRing {
+        SharedMemory _memory;
+        detail::RingHeader* _header;
+        math::Point2f* _data;
+        uint64_t _mask;
+        // Last seen value of the other side's index, re-read only when it looks like the ring
+        // is full (producer) or empty (consumer), to keep the cache line from bouncing
+        uint64_t _cached_tail;
+        uint64_t _cached_head;
+
+        explicit PointRing(SharedMemory memory)
+            : _memory(std::move(memory)),
+              _header(static_cast<detail::RingHeader*>(_memory.Data())),
+              _data(reinterpret_cast<math::Point2f*>(static_cast<char*>(_memory.Data()) + detail::kRingData)),
+              _mask(_header->capacity - 1),
+              _cached_tail(_header->tail.load(std::memory_order_acquire)),
+              _cached_head(_header->head.load(std::memory_order_acquire)) {}
+
+    public:
+        static size_t BytesFor(const size_t capacity) {
+            return detail::kRingData + capacity * sizeof(math::Point2f);
+        }
+
+        // Consumer side. `capacity` is in points and has to be a power of two. Fails if the name
+        // exists, which after a consumer crash means a stale ring; `reclaim` unlinks it first.
+        static PointRing Create(std::string name, const size_t capacity, const bool reclaim = false) {
+            if (capacity == 0 || (capacity & (capacity - 1)) != 0) throw std::runtime_error("Ring capacity has to be a power of two");
+            if (reclaim) SharedMemory::Unlink(name);
+            auto memory = SharedMemory::Create(std::move(name), BytesFor(capacity));
+            // The segment is zero filled, which is a valid state for every field but the magic
+            auto* header = new (memory.Data()) detail::RingHeader {};
+            header->capacity = capacity;
+            header->magic.store(detail::kRingMagic, std::memory_order_release);
+            return PointRing(std::move(memory));
+        }
+
+        // Producer side
+        static PointRing Open(std::string name) {
+            auto memory = SharedMemory::Open(std::move(name));
+            const auto* header = static_cast<const detail::RingHeader*>(memory.Data());
+            if (memory.Size() < sizeof(detail::RingHeader) || header->magic.load(std::memory_order_acquire) != detail::kRingMagic
+                || memory.Size() < BytesFor(header->capacity)) {
+                throw std::runtime_error("Shared memory is not a point ring");
+            }
+            return PointRing(std::move(memory));
+        }
+
+        // Contiguous free slots, at most `max`, to be filled and then passed to Commit. Empty
+        // when the ring is full. The span stops at the end of the buffer, so a second call may
+        // return more after a wrap.
+        std::span<math::Point2f> Reserve(const size_t max = std::numeric_limits<size_t>::max()) {
+            const uint64_t head = _header->head.load(std::memory_order_relaxed);
+            if (head - _cached_tail == _header->capacity) {
+                _cached_tail = _header->tail.load(std::memory_order_acquire);
+            }
+            const size_t free = _header->capacity - (head - _cached_tail);
+            const size_t offset = head & _mask;
+            return {_data + offset, std::min({max, free, _header->capacity - offset})};
+        }
+
+        // Publishes the first n points of the last Reserve
+        void Commit(const size_t n) {
+            _header->head.store(_header->head.load(std::memory_order_relaxed) + n, std::memory_order_release);
+        }
+
+        // Copies as many points as fit without waiting and returns how many that was
+        size_t TryWrite(const std::span<const math::Point2f> points) {
+            size_t written = 0;
+            while (written < points.size()) {
+                const auto slots = Reserve(points.size() - written);
+                if (slots.empty()) break;
+                std::memcpy(slots.data(), points.data() + written, slots.size_bytes());
+                Commit(slots.size());
+                written += slots.size();
+            }
+            return written;
+        }
+
+        // Copies every point, waiting for the consumer while the ring is full
+        void Write(std::span<const math::Point2f> points) {
+            detail::Backoff backoff;
+            while (!points.empty()) {
+                const size_t written = TryWrite(points);
+                points = points.subspan(written);
+                if (written == 0) backoff.Wait();
+                else backoff = {};
+            }
+        }
+
+        // Tells the consumer that nothing more is coming
+        void Close() {
+            _header->closed.store(1, std::memory_order_release);
+        }
+
+        // Contiguous committed points, at most `max`, to be read in place and then passed to
+        // Release. Empty when the ring is empty.
+        std::span<const math::Point2f> Peek(const size_t max = std::numeric_limits<size_t>::max()) {
+            const uint64_t tail = _header->tail.load(std::memory_order_relaxed);
+            if (_cached_head == tail) {
+                _cached_head = _header->head.load(std::memory_order_acquire);
+            }
+            const size_t offset = tail & _mask;
+            return {_data + offset, std::min({max, static_cast<size_t>(_cached_head - tail), _header->capacity - offset})};
+        }
+
+        // Hands the first n points of the last Peek back to the producer
+        void Release(const size_t n) {
+            _header->tail.store(_header->tail.load(std::memory_order_relaxed) + n, std::memory_order_release);
+        }
+
+        // Calls f(span) on up to `max` available points, at most twice when they wrap, releasing
+        // each span after f returns. Does not wait; returns how many points were consumed.
+        template <class F>
+        size_t Consume(F&& f, const size_t max = std::numeric_limits<size_t>::max()) {
+            size_t consumed = 0;
+            for (int i = 0; i < 2 && consumed < max; i++) {
+                const auto points = Peek(max - consumed);
+                if (points.empty()) break;
+                f(points);
+                Release(points.size());
+                consumed += points.size();
+            }
+            return consumed;
+        }
+
+        // The producer has closed the ring and everything it wrote has been consumed
+        [[nodiscard]] bool Finished() const {
+            return _header->closed.load(std::memory_order_acquire)
+                   && _header->head.load(std::memory_order_acquire) == _header->tail.load(std::memory_order_relaxed);
+        }
+
+        [[nodiscard]] size_t Capacity() const {
+            return _header->capacity;
+        }
+
+        // Committed points not yet released; only a snapshot while the other side is running
+        [[nodiscard]] size_t Size() const {
+            return _header->head.load(std::memory_order_acquire) - _header->tail.load(std::memory_order_acquire);
+        }
+    };
+
+    // Consumes until the producer has closed the ring and it is empty, or until nothing has
+    // arrived for `idle`, which is how a producer that died without closing shows up. Returns
+    // whether the ring finished.
+    template <class F>
+    bool Drain(PointRing& ring, F&& f, const std::chrono::milliseconds idle) {
+        detail::Backoff backoff;
+        auto last = std::chrono::steady_clock::now();
+        while (!ring.Finished()) {
+            if (ring.Consume(f) > 0) {
+                backoff = {};
+                last = std::chrono::steady_clock::now();
+            } else if (std::chrono::steady_clock::now() - last > idle) {
+                return false;
+            } else {
+                backoff.Wait();
+            }
+        }
+        return true;
+    }
+
+    // Reference producer: generates `count` points in batches of at most `batch`, straight into
+    // the ring through generate(span<Point2f> slots, size_t first_index), waits while the ring is
+    // full, and closes it at the end
+    template <class Generate>
+    void Produce(PointRing& ring, const size_t count, const size_t batch, Generate&& generate) {
+        detail::Backoff backoff;
+        size_t produced = 0;
+        while (produced < count) {
+            const auto slots = ring.Reserve(std::min(batch, count - produced));
+            if (slots.empty()) {
+                backoff.Wait();
+                continue;
+            }
+            backoff = {};
+            generate(slots, produced);
+            ring.Commit(slots.size());
+            produced += slots.size();
+        }
+        ring.Close();
+    }
+} // namespace geom::ipc
+
+#endif // CPPGEOMETRY_POINT_RING_HPP
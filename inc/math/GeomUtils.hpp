@@ -4,6 +4,7 @@
 #include "Math.hpp"
 #include "Vector.hpp"
 #include "Point.hpp"
+#include "../exec/Policy.hpp"
 
 
 
@@ -71,19 +72,42 @@ namespace geom::math
             return IsEqual(area, 0.0f);
         }
 
-        inline Orientation Orientation2d(const Point2f &a, const Point2f &b, const Point2f &c)
+        template <Arithmetic T, size_t dim>
+        Wide<T> SquaredDistance(const Vector<T, dim> &a, const Vector<T, dim> &b)
+        {
+            Wide<T> result = 0;
+            for (size_t i = 0; i < dim; i++)
+            {
+                const Wide<T> d = static_cast<Wide<T>>(b[i]) - a[i];
+                result += d * d;
+            }
+            return result;
+        }
+
+        // Coordinate differences and products are taken in Wide<T>, or Eval when given, so the
+        // integer instantiations are exact and only floating point evaluation snaps near-zero areas
+        // to collinear, with a tolerance that shrinks with the evaluation type's epsilon
+        template <EvaluationType Eval = void, Arithmetic T = float>
+        Orientation Orientation2d(const Vector<T, DIM2> &a, const Vector<T, DIM2> &b, const Vector<T, DIM2> &c)
         {
             if (a == c)
                 return Orientation::ORIGIN;
             if (b == c)
                 return Orientation::DESTINATION;
 
-            const Vector2f ab = b - a;
-            const Vector2f ac = c - a;
+            using W = Evaluation<Eval, T>;
+            const W ab_x = static_cast<W>(b.x()) - a.x();
+            const W ab_y = static_cast<W>(b.y()) - a.y();
+            const W ac_x = static_cast<W>(c.x()) - a.x();
+            const W ac_y = static_cast<W>(c.y()) - a.y();
 
-            auto area = Area2d(ab, ac);
-            if (IsEqual(area, 0.0f))
-                area = 0.0;
+            W area = ab_x * ac_y - ab_y * ac_x;
+            if constexpr (std::floating_point<W>)
+            {
+                area /= 2;
+                if (IsEqual(area, W{0}))
+                    area = 0;
+            }
 
             if (area < 0)
                 return Orientation::NEGATIVE;
@@ -91,19 +115,30 @@ namespace geom::math
                 return Orientation::POSITIVE;
 
             // Vectors are coincident
-            if (Dot(ab, ac) < 0)
+            if (ab_x * ac_x + ab_y * ac_y < 0)
                 return Orientation::BEHIND;
-            if (ab.Norm() < ac.Norm())
+            if (ab_x * ab_x + ab_y * ab_y < ac_x * ac_x + ac_y * ac_y)
                 return Orientation::BEYOND;
 
             return Orientation::IN_INTERVAL;
         }
 
-        inline void LexicographicOrder(std::vector<math::Point2f>& points) {
-            std::ranges::sort(points
-                              , [](const Point2f &a, const Point2f &b) {
-                                  return (a.x() < b.x()) || (IsEqual(a.x(), b.x()) && a.y() < b.y());
-                              });
+        // Exact comparison: a tolerance on x is not a strict weak ordering, which std::sort and
+        // the block merges of the parallel sort both rely on
+        template <Arithmetic T = float>
+        bool LexicographicLess(const Vector<T, DIM2> &a, const Vector<T, DIM2> &b) {
+            return (a.x() < b.x()) || (a.x() == b.x() && a.y() < b.y());
+        }
+
+        template <Arithmetic T = float>
+        void LexicographicOrder(std::vector<Vector<T, DIM2>>& points) {
+            std::ranges::sort(points, [](const auto &a, const auto &b) { return LexicographicLess(a, b); });
+        }
+
+        template <exec::ExecutionPolicy P, Arithmetic T = float>
+        void LexicographicOrder(const P& policy, std::vector<Vector<T, DIM2>>& points) {
+            exec::Sort(policy, points.begin(), points.end(),
+                       [](const auto &a, const auto &b) { return LexicographicLess(a, b); });
         }
 
     } // namespace geom::math
@@ -8,7 +8,7 @@
 
 
 namespace geom::math {
-        template<std::floating_point T, size_t dim = DIM3>
+        template<Arithmetic T, size_t dim = DIM3>
         class Line {
             Vector<T, dim> origin;
             Vector<T, dim> dest;
@@ -27,24 +27,26 @@ namespace geom::math {
             [[nodiscard]] const Vector<T, dim> &GetDest() const { return dest; }
             [[nodiscard]] const Vector<T, dim> GetDir() const { return dest - origin; }
 
+            template <EvaluationType Eval = void>
             bool Contains(const Vector<T, dim> &point) const {
-                auto orientation = Orientation2d(origin, dest, point);
+                auto orientation = Orientation2d<Eval>(origin, dest, point);
                 return orientation == Orientation::ORIGIN
                        ||  orientation == Orientation::DESTINATION
                        ||  orientation == Orientation::IN_INTERVAL;
             }
 
+            template <EvaluationType Eval = void>
             bool Intersects(const Line &other) const requires (dim == DIM2) {
-                if (this->Contains(other.origin)
-                    || this->Contains(other.dest)
-                    || other.Contains(this->origin)
-                    || other.Contains(this->dest)
+                if (this->template Contains<Eval>(other.origin)
+                    || this->template Contains<Eval>(other.dest)
+                    || other.template Contains<Eval>(this->origin)
+                    || other.template Contains<Eval>(this->dest)
                     ) return true;
 
-                auto other_origin = Orientation2d(origin, dest, other.origin);
-                auto other_dest = Orientation2d(origin, dest, other.dest);
-                auto this_origin = Orientation2d(other.origin, other.dest, origin);
-                auto this_dest = Orientation2d(other.origin, other.dest, dest);
+                auto other_origin = Orientation2d<Eval>(origin, dest, other.origin);
+                auto other_dest = Orientation2d<Eval>(origin, dest, other.dest);
+                auto this_origin = Orientation2d<Eval>(other.origin, other.dest, origin);
+                auto this_dest = Orientation2d<Eval>(other.origin, other.dest, dest);
 
                 return _xor(other_origin == Orientation::NEGATIVE, other_dest == Orientation::NEGATIVE)
                        && _xor(this_origin == Orientation::NEGATIVE, this_dest == Orientation::NEGATIVE);
@@ -52,12 +54,18 @@ namespace geom::math {
 
         };
 
-        inline Point2f GetIntersection(const Line<float, 2>& a, const Line<float, 2> &b)  {
-        const auto dir_b = b.GetDir();
-        const auto normal_b = Vector2f {-dir_b.y(), dir_b.x()};
+        // Evaluated in Eval when given, e.g. GetIntersection<double> on float lines, and rounded
+        // to T once at the end
+        template <EvaluationType Eval = void, std::floating_point T = float>
+        Vector<T, 2> GetIntersection(const Line<T, 2>& a, const Line<T, 2> &b)  {
+        using E = Evaluation<Eval, T>;
+        const auto &a0 = a.GetOrigin(), &a1 = a.GetDest(), &b0 = b.GetOrigin(), &b1 = b.GetDest();
+        const E dir_a_x = static_cast<E>(a1.x()) - a0.x(), dir_a_y = static_cast<E>(a1.y()) - a0.y();
+        const E normal_b_x = static_cast<E>(b0.y()) - b1.y(), normal_b_y = static_cast<E>(b1.x()) - b0.x();
 
-        const auto t = Dot(normal_b, a.GetOrigin() - b.GetOrigin()) / Dot(normal_b, a.GetDest() - a.GetOrigin());
-        return a.GetOrigin() + a.GetDir() * std::abs(t);
+        const E t = (normal_b_x * (static_cast<E>(a0.x()) - b0.x()) + normal_b_y * (static_cast<E>(a0.y()) - b0.y()))
+                    / (normal_b_x * dir_a_x + normal_b_y * dir_a_y);
+        return {static_cast<T>(a0.x() + dir_a_x * std::abs(t)), static_cast<T>(a0.y() + dir_a_y * std::abs(t))};
     }
     } // namespace geom::math
 
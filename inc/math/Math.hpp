@@ -6,13 +6,74 @@
 #define CPPGEOMETRY_MATH_H
 
 #include <cmath>
+#include <concepts>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
 
 
 namespace geom::math {
+    // Type that holds differences and products of coordinates without loss. Integer coordinates
+    // are exact up to int32, so that predicates on grid-snapped data never need a tolerance.
+    // Types without a specialisation here are not coordinates.
+    template <class T>
+    struct WideType {};
+
+    template <std::floating_point T>
+    struct WideType<T> { using type = T; };
+
+    template <>
+    struct WideType<int16_t> { using type = int64_t; };
+
+    // int32 needs a 128-bit product, which only GCC and Clang provide. Other compilers get
+    // int16 as the only exact integer coordinate.
+#if defined(__SIZEOF_INT128__)
+    template <>
+    struct WideType<int32_t> { __extension__ typedef __int128 type; };
+#endif
+
+    // Coordinate types: floating point, plus the integers with an exact wide type above
+    template <class T>
+    concept Arithmetic = requires { typename WideType<T>::type; };
+
+    template <Arithmetic T>
+    using Wide = typename WideType<T>::type;
+
+    // Signed integers, including __int128, which std::signed_integral misses outside GNU modes
+    template <class T>
+#if defined(__SIZEOF_INT128__)
+    concept SignedInteger = std::signed_integral<T> || std::same_as<T, WideType<int32_t>::type>;
+#else
+    concept SignedInteger = std::signed_integral<T>;
+#endif
+
+    // Predicates take an optional evaluation type, e.g. Orientation2d<double> on float points
+    // stores float but decides in double. void, the default, evaluates in Wide<T>.
+    template <class Eval>
+    concept EvaluationType = std::is_void_v<Eval> || std::floating_point<Eval> || SignedInteger<Eval>;
+
+    // Eval can stand in for Wide<T>: the same kind of number and at least as wide, so an explicit
+    // evaluation type can only add precision, never lose the exactness of integer coordinates
+    template <class Eval, class T>
+    concept EvaluatesExactly = std::is_void_v<Eval>
+                               || (std::floating_point<Eval> == std::floating_point<T> && sizeof(Eval) >= sizeof(Wide<T>));
+
+    template <EvaluationType Eval, Arithmetic T> requires EvaluatesExactly<Eval, T>
+    using Evaluation = typename std::conditional_t<std::is_void_v<Eval>, WideType<T>, std::type_identity<Eval>>::type;
+
+    // Lengths of T vectors: double stays double, everything else is reported in float
+    template <Arithmetic T>
+    using Real = std::conditional_t<std::floating_point<T> && (sizeof(T) > sizeof(float)), T, float>;
+
     template <std::floating_point T>
     bool IsEqual(const T _x, const T _y){
         return std::abs(_x - _y) < std::numeric_limits<T>::epsilon() * 100;
     }
+
+    template <std::integral T>
+    bool IsEqual(const T _x, const T _y){
+        return _x == _y;
+    }
     inline bool _xor(const bool _a, const bool _b) {
         return _a ^ _b;
     }
@@ -7,6 +7,10 @@
 namespace geom::math {
     typedef Vector2f Point2f;
     typedef Vector3f Point3f;
+    typedef Vector2d Point2d;
+    typedef Vector3d Point3d;
+    typedef Vector2i Point2i;
+    typedef Vector2s Point2s;
 } // namespace geom::math
 
 
@@ -0,0 +1,75 @@
+#ifndef CPPGEOMETRY_QUANTIZE_H
+#define CPPGEOMETRY_QUANTIZE_H
+
+#include "Point.hpp"
+#include <stdexcept>
+#include <vector>
+
+namespace geom::math {
+    // Maps a float cloud onto a symmetric integer grid covering its bounding box, so that the
+    // exact integer predicates can be used. Precision is the box extent over 2^bits.
+    template <std::integral I>
+    class Quantizer {
+        Point2f _center;
+        float _scale;
+
+        // Float rounding can push the extremes one step past the range of I
+        [[nodiscard]] I ToGrid(const float offset) const {
+            constexpr auto limit = static_cast<long long>(std::numeric_limits<I>::max());
+            return static_cast<I>(std::clamp(std::llround(static_cast<double>(offset) * _scale), -limit, limit));
+        }
+
+        public:
+            Quantizer() = delete;
+            Quantizer(const Point2f& center, const float scale) : _center(center), _scale(scale) {
+                if (!(scale > 0)) {
+                    throw std::runtime_error("Require a positive quantization scale");
+                }
+            };
+            explicit Quantizer(const std::vector<Point2f>& points) {
+                if (points.empty()) {
+                    throw std::runtime_error("Cannot fit a quantizer to an empty point set");
+                }
+                auto [min_x, max_x] = std::ranges::minmax(points | std::views::transform([](const Point2f& p) { return p.x(); }));
+                auto [min_y, max_y] = std::ranges::minmax(points | std::views::transform([](const Point2f& p) { return p.y(); }));
+                _center = {(min_x + max_x) / 2, (min_y + max_y) / 2};
+
+                const float half_extent = std::max(max_x - min_x, max_y - min_y) / 2;
+                _scale = IsEqual(half_extent, 0.0f) ? 1.0f : std::numeric_limits<I>::max() / half_extent;
+            }
+
+            [[nodiscard]] Vector<I, DIM2> Quantize(const Point2f& p) const {
+                return {ToGrid(p.x() - _center.x()), ToGrid(p.y() - _center.y())};
+            }
+
+            [[nodiscard]] Point2f Dequantize(const Vector<I, DIM2>& q) const {
+                return {q.x() / _scale + _center.x(), q.y() / _scale + _center.y()};
+            }
+
+            [[nodiscard]] std::vector<Vector<I, DIM2>> Quantize(const std::vector<Point2f>& points) const {
+                std::vector<Vector<I, DIM2>> result;
+                result.reserve(points.size());
+                std::ranges::transform(points, std::back_inserter(result),
+                                       [this](const Point2f& p) { return Quantize(p); });
+                return result;
+            }
+
+            [[nodiscard]] std::vector<Point2f> Dequantize(const std::vector<Vector<I, DIM2>>& points) const {
+                std::vector<Point2f> result;
+                result.reserve(points.size());
+                std::ranges::transform(points, std::back_inserter(result),
+                                       [this](const Vector<I, DIM2>& q) { return Dequantize(q); });
+                return result;
+            }
+
+            [[nodiscard]] const Point2f& GetCenter() const {
+                return _center;
+            }
+
+            [[nodiscard]] float GetScale() const {
+                return _scale;
+            }
+    };
+} // namespace geom::math
+
+#endif //CPPGEOMETRY_QUANTIZE_H
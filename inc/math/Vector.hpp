@@ -19,7 +19,7 @@ namespace geom::math {
 static constexpr size_t DIM2 = 2;
 static constexpr size_t DIM3 = 3;
 
-template <std::floating_point T, size_t dim> requires (dim >= 2)
+template <Arithmetic T, size_t dim> requires (dim >= 2)
   class Vector {
 
   std::array<T, dim> _coords;
@@ -127,22 +127,22 @@ public:
     return _coords[2];
   }
 
-  [[nodiscard]] float Norm() const {
+  [[nodiscard]] Real<T> Norm() const {
     auto squares_view =
-        _coords | std::views::transform([](T n) { return n * n; });
-    const float result =
+        _coords | std::views::transform([](T n) { return static_cast<double>(n) * n; });
+    const Real<T> result =
         std::accumulate(squares_view.begin(), squares_view.end(), 0.0);
     return sqrt(result);
   }
-  void ToUnitVector() {
-    float magnitude = Norm();
+  void ToUnitVector() requires std::floating_point<T> {
+    Real<T> magnitude = Norm();
     if (IsEqual<T>(magnitude, 0.0)) throw std::runtime_error("Tried to normalize a vector with zero norm");
     std::for_each(_coords.begin(), _coords.end(),
                   [magnitude](T &c) { c /= magnitude; });
   }
-  [[nodiscard]] Vector Normalise() const {
+  [[nodiscard]] Vector Normalise() const requires std::floating_point<T> {
     std::array<T, dim> result {};
-    float magnitude = Norm();
+    Real<T> magnitude = Norm();
     if (IsEqual<T>(magnitude, 0.0)) throw std::runtime_error("Tried to normalize a vector with zero norm");
     std::transform(_coords.begin(), _coords.end(), result.begin(),
                    [magnitude](const T &c) { return c / magnitude; });
@@ -152,10 +152,10 @@ public:
   };
 
 template <class T, size_t dim = DIM3>
-float Dot(const Vector<T, dim> &a, const Vector<T, dim> &b) {
-  float result = 0;
+Wide<T> Dot(const Vector<T, dim> &a, const Vector<T, dim> &b) {
+  Wide<T> result = 0;
   for (size_t i = 0; i < dim; i++) {
-    result += a[i] * b[i];
+    result += static_cast<Wide<T>>(a[i]) * b[i];
   }
 
   return result;
@@ -175,9 +175,14 @@ std::ostream &operator<<(std::ostream &os, const Vector<T, dim> &v) {
 
 typedef Vector<float, DIM2> Vector2f;
 typedef Vector<float, DIM3> Vector3f;
-
-inline float Cross2D(const Vector2f &a, const Vector2f &b) {
-  return a.x() * b.y() - a.y() * b.x();
+typedef Vector<double, DIM2> Vector2d;
+typedef Vector<double, DIM3> Vector3d;
+typedef Vector<int32_t, DIM2> Vector2i;
+typedef Vector<int16_t, DIM2> Vector2s;
+
+template <class T>
+Wide<T> Cross2D(const Vector<T, DIM2> &a, const Vector<T, DIM2> &b) {
+  return static_cast<Wide<T>>(a.x()) * b.y() - static_cast<Wide<T>>(a.y()) * b.x();
 }
 
 inline Vector3f Cross3D(const Vector3f &a, const Vector3f &b) {
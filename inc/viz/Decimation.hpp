@@ -0,0 +1,108 @@
+#ifndef CPPGEOMETRY_DECIMATION_HPP
+#define CPPGEOMETRY_DECIMATION_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+#include "../math/Point.hpp"
+
+// Screen-space level of detail for the Renderer, kept free of SFML so it can be tested
+namespace geom::viz {
+    // Buckets screen-space points into a grid of square cells and keeps one representative (the
+    // first point to land in the cell) and a count per cell. Drawing the occupied cells costs
+    // O(width * height / cell_size^2) however many points were added. Adding is O(1) per point and
+    // only touches the new points, and Clear is O(occupied cells).
+    class ScreenDecimator {
+        size_t _columns;
+        size_t _rows;
+        float _inv_cell_size;
+        std::vector<uint32_t> _counts;
+        std::vector<math::Point2f> _representatives;
+        // Cell indices in the order they were first occupied
+        std::vector<uint32_t> _occupied;
+        uint32_t _max_count = 0;
+        size_t _points = 0;
+        size_t _culled = 0;
+        uint64_t _version = 0;
+
+        // Runs ahead of the member initialisers, which divide by cell_size
+        static float Validated_(const size_t width, const size_t height, const float cell_size) {
+            if (width == 0 || height == 0 || !(cell_size > 0) || !std::isfinite(cell_size)) {
+                throw std::runtime_error("Require a non-empty screen and a positive cell size");
+            }
+            return cell_size;
+        }
+
+    public:
+        ScreenDecimator(const size_t width, const size_t height, const float cell_size = 1)
+            : _columns(static_cast<size_t>(std::ceil(width / Validated_(width, height, cell_size)))),
+              _rows(static_cast<size_t>(std::ceil(height / cell_size))),
+              _inv_cell_size(1 / cell_size) {
+            _counts.assign(_columns * _rows, 0);
+            _representatives.resize(_columns * _rows);
+        }
+
+        // Points in screen coordinates; those off screen are counted in Culled() and otherwise ignored
+        void Add(const std::span<const math::Point2f> points) {
+            for (const auto& p : points) {
+                const float column = p.x() * _inv_cell_size;
+                const float row = p.y() * _inv_cell_size;
+                if (!(column >= 0 && row >= 0 && column < _columns && row < _rows)) {
+                    _culled++;
+                    continue;
+                }
+                const size_t cell = static_cast<size_t>(row) * _columns + static_cast<size_t>(column);
+                if (_counts[cell]++ == 0) {
+                    _representatives[cell] = p;
+                    _occupied.push_back(static_cast<uint32_t>(cell));
+                }
+                _max_count = std::max(_max_count, _counts[cell]);
+            }
+            _points += points.size();
+            if (!points.empty()) _version++;
+        }
+
+        void Clear() {
+            for (const uint32_t cell : _occupied) _counts[cell] = 0;
+            _occupied.clear();
+            _max_count = 0;
+            _points = 0;
+            _culled = 0;
+            _version++;
+        }
+
+        // Calls f(representative, count) for every occupied cell
+        template <class F>
+        void ForEachCell(F&& f) const {
+            for (const uint32_t cell : _occupied) f(_representatives[cell], _counts[cell]);
+        }
+
+        [[nodiscard]] size_t Cells() const {
+            return _occupied.size();
+        }
+
+        [[nodiscard]] uint32_t MaxCount() const {
+            return _max_count;
+        }
+
+        // Every point passed to Add since the last Clear, including culled ones
+        [[nodiscard]] size_t Points() const {
+            return _points;
+        }
+
+        [[nodiscard]] size_t Culled() const {
+            return _culled;
+        }
+
+        // Changes whenever the cells do, so a renderer can tell when its vertex buffer is stale
+        [[nodiscard]] uint64_t Version() const {
+            return _version;
+        }
+    };
+} // namespace geom::viz
+
+#endif // CPPGEOMETRY_DECIMATION_HPP
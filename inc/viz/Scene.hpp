@@ -0,0 +1,106 @@
+#ifndef CPPGEOMETRY_SCENE_HPP
+#define CPPGEOMETRY_SCENE_HPP
+
+#include <cstdint>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+#include "../math/Line.hpp"
+#include "../math/Point.hpp"
+
+// The Renderer's geometry, kept free of SFML and HighFive so it can be tested
+namespace geom::viz {
+    // Canonical copy of everything on screen, in screen coordinates, which is what both the
+    // algorithms and the draw calls consume. Datasets are N x 2 float arrays in the unit square
+    // with y up, and segments are consecutive pairs of rows. Loaders write the rows straight into
+    // the scene's storage, which keeps its capacity across Clear, so reloading and rerunning
+    // allocate nothing once the scene has reached its working size.
+    class Scene {
+        float _width;
+        float _height;
+        std::vector<math::Point2f> _points;
+        std::vector<math::Line<float, 2>> _segments;
+        // Line has no default constructor to read into, so segment rows land here first
+        std::vector<math::Point2f> _endpoints;
+        uint64_t _version = 0;
+
+        static_assert(sizeof(math::Point2f) == 2 * sizeof(float) && std::is_standard_layout_v<math::Point2f>,
+                      "Points are filled as interleaved x, y floats");
+
+        [[nodiscard]] math::Point2f ToScreen_(const math::Point2f& p) const {
+            return {p.x() * _width, _height - p.y() * _height};
+        }
+
+    public:
+        Scene(const float width, const float height) : _width(width), _height(height) {
+            if (!(width > 0 && height > 0)) throw std::runtime_error("Require a non-empty screen");
+        }
+
+        // Appends `rows` points, calling fill(float* xy) to write them as interleaved unit-square
+        // coordinates, e.g. with HighFive's read_raw, then maps them to the screen in place. If
+        // fill throws, the scene is left as it was.
+        template <class Fill>
+        void LoadPoints(const size_t rows, Fill&& fill) {
+            const size_t first = _points.size();
+            _points.resize(first + rows);
+            try {
+                fill(reinterpret_cast<float*>(_points.data() + first));
+            } catch (...) {
+                _points.resize(first);
+                throw;
+            }
+            for (size_t i = first; i < _points.size(); i++) _points[i] = ToScreen_(_points[i]);
+            _version++;
+        }
+
+        // As LoadPoints, with every two rows forming a segment; a trailing odd row is ignored.
+        // Line rejects zero-length segments, so those are skipped and their number returned.
+        template <class Fill>
+        size_t LoadSegments(const size_t rows, Fill&& fill) {
+            _endpoints.resize(rows);
+            fill(reinterpret_cast<float*>(_endpoints.data()));
+            size_t skipped = 0;
+            for (size_t i = 0; i + 1 < rows; i += 2) {
+                const auto origin = ToScreen_(_endpoints[i]);
+                const auto dest = ToScreen_(_endpoints[i + 1]);
+                if (origin == dest) {
+                    skipped++;
+                    continue;
+                }
+                _segments.emplace_back(origin, dest);
+            }
+            _version++;
+            return skipped;
+        }
+
+        // Points already in screen coordinates, such as algorithm results
+        void AddPoints(const std::span<const math::Point2f> points) {
+            _points.insert(_points.end(), points.begin(), points.end());
+            _version++;
+        }
+
+        void Clear() {
+            _points.clear();
+            _segments.clear();
+            _version++;
+        }
+
+        // The algorithms take vectors, so these hand out the storage itself rather than a span
+        [[nodiscard]] const std::vector<math::Point2f>& Points() const {
+            return _points;
+        }
+
+        [[nodiscard]] const std::vector<math::Line<float, 2>>& Segments() const {
+            return _segments;
+        }
+
+        // Changes whenever the geometry does, so views of it can tell when they are stale
+        [[nodiscard]] uint64_t Version() const {
+            return _version;
+        }
+    };
+} // namespace geom::viz
+
+#endif // CPPGEOMETRY_SCENE_HPP
@@ -7,17 +7,18 @@
 #include <highfive/highfive.hpp>
 
 #include "../alg/ConvexHull.hpp"
-#include "../math/Line.hpp"
+#include "../alg/SegmentIntersection.hpp"
+#include "../cache/ResultCache.hpp"
+#include "../ipc/PointRing.hpp"
 #include "../math/Point.hpp"
+#include "Decimation.hpp"
+#include "Scene.hpp"
 
 namespace geom {
     namespace viz {
-        typedef std::vector<std::array<float, 2>> PointList;
-        typedef std::vector<std::array<float, 4>> LineList;
-
         class Renderer {
         public:
-            Renderer() : convex_hull_points_(-1), line_segments_(-1) {
+            Renderer() : convex_hull_points_(-1), line_segments_(-1), hull_cache_(16), scene_(kWidth, kHeight), lod_(kWidth, kHeight) {
                 window_ = sf::RenderWindow(sf::VideoMode({kWidth, kHeight}), "Geometry Renderer");
                 window_.setFramerateLimit(60);
                 std::ignore = ImGui::SFML::Init(window_);
@@ -30,80 +31,112 @@ namespace geom {
                 }
             }
 
+            // Creates a shared-memory ring that a producer process can stream points into. Throws
+            // if the name is taken; `reclaim` replaces a ring left behind by a crashed renderer.
+            void Attach(const std::string &ring_name, const bool reclaim = false) {
+                stream_.emplace(ipc::PointRing::Create(ring_name, kStreamCapacity, reclaim));
+            }
+
             void Clear_() {
                 shapes_.clear();
-                lines_.clear();
+                scene_.Clear();
+                lod_.Clear();
+                stream_hull_.Clear();
+                stream_hull_shape_ = MakeConvex_({});
             }
 
-            void AddPoints_(const PointList &points) {
-                for (const auto &coords: points) {
-                    auto c = sf::CircleShape(1.0);
-                    c.setFillColor(sf::Color::Green);
-                    float x = coords[0] * kWidth;
-                    float y = kHeight - coords[1] * kHeight;
-                    c.setPosition({x, y});
-                    shapes_.push_back(std::make_unique<sf::CircleShape>(c));
-                }
+            // Moves what the producer has committed into the scene and grows the stream's hull
+            // from it. At most kStreamBudget points are taken per frame; the rest stays in the
+            // ring, which holds the producer back rather than stalling the frame.
+            void PollStream_() {
+                if (!stream_) return;
+                bool changed = false;
+                stream_->Consume([this, &changed](const std::span<const math::Point2f> batch) {
+                    const size_t first = scene_.Points().size();
+                    scene_.LoadPoints(batch.size(), [&batch](float *xy) {
+                        std::memcpy(xy, batch.data(), batch.size_bytes());
+                    });
+                    changed |= stream_hull_.Add(std::span(scene_.Points()).subspan(first));
+                }, kStreamBudget);
+                if (changed) stream_hull_shape_ = MakeConvex_(stream_hull_.Hull());
             }
 
-            void AddLines_(const PointList &points) {
-                for (int i = 0; i < points.size() - 1; i+=2) {
-                    lines_.emplace_back(std::array{
-                        sf::Vertex({points[i][0], points[i][1]}, sf::Color::White),
-                        sf::Vertex({points[i + 1][0], points[i + 1][1]}, sf::Color::White)
-                    });
+            // Rebuilds the point vertices from the LOD grid when it has changed, so each frame
+            // draws at most one vertex per pixel. Only points added to the scene since the last
+            // sync go through the grid.
+            void SyncLod_() {
+                const auto &points = scene_.Points();
+                if (lod_.Points() < points.size()) lod_.Add(std::span(points).subspan(lod_.Points()));
+                if (lod_version_ == lod_.Version()) return;
+                lod_version_ = lod_.Version();
+                lod_vertices_.clear();
+                const double max_count = std::log1p(std::max<uint32_t>(1, lod_.MaxCount()));
+                lod_.ForEachCell([this, max_count](const math::Point2f &p, const uint32_t count) {
+                    // Denser pixels are brighter, on a log scale so isolated points stay visible
+                    const auto shade = static_cast<uint8_t>(96 + 159 * std::log1p(count) / max_count);
+                    lod_vertices_.append(sf::Vertex({p.x(), p.y()}, sf::Color(0, shade, 0)));
+                });
+            }
+
+            // Segment vertices only change with the scene, so they are rebuilt then rather than per frame
+            void SyncLines_() {
+                if (lines_version_ == scene_.Version()) return;
+                lines_version_ = scene_.Version();
+                line_vertices_.clear();
+                for (const auto &segment: scene_.Segments()) {
+                    const auto &origin = segment.GetOrigin();
+                    const auto &dest = segment.GetDest();
+                    line_vertices_.append(sf::Vertex({origin.x(), origin.y()}, sf::Color::White));
+                    line_vertices_.append(sf::Vertex({dest.x(), dest.y()}, sf::Color::White));
                 }
             }
 
-            void AddConvex_(const PointList &points) {
+            static sf::ConvexShape MakeConvex_(const std::vector<math::Point2f> &points) {
                 sf::ConvexShape convex;
                 convex.setFillColor(sf::Color::Transparent);
                 convex.setOutlineThickness(1.f);
                 convex.setOutlineColor(sf::Color::Cyan);
                 convex.setPointCount(points.size());
                 for (int i = 0; i < points.size(); ++i) {
-                    convex.setPoint(i, {points[i][0], points[i][1]});
+                    convex.setPoint(i, {points[i].x(), points[i].y()});
                 }
-                shapes_.emplace_back(std::make_unique<sf::ConvexShape>(convex));
+                return convex;
+            }
+
+            void AddConvex_(const std::vector<math::Point2f> &points) {
+                shapes_.emplace_back(std::make_unique<sf::ConvexShape>(MakeConvex_(points)));
             }
 
-            static void LoadPoints_(
-                const std::string_view path,
-                const std::function<void(const PointList&)> &adder
-                ) {
-                const auto p = path.data() + std::string(".h5");
-                const HighFive::File file(p, HighFive::File::ReadOnly);
-                const auto dataset = file.getDataSet("points");
-                const auto data = dataset.read<PointList>();
-                adder(data);
+            // Reads the N x 2 "points" dataset straight into the scene's storage. Failures are
+            // shown in the UI rather than thrown out of the frame.
+            void Load_(const std::string_view path, const bool segments) {
+                load_status_.clear();
+                try {
+                    const HighFive::File file(std::string(path) + ".h5", HighFive::File::ReadOnly);
+                    const auto dataset = file.getDataSet("points");
+                    const auto dims = dataset.getDimensions();
+                    if (dims.size() != 2 || dims[1] != 2) throw std::runtime_error("Expected an N x 2 dataset in " + std::string(path));
+                    const auto read = [&dataset](float *xy) { dataset.read_raw(xy); };
+                    if (!segments) {
+                        scene_.LoadPoints(dims[0], read);
+                    } else if (const size_t skipped = scene_.LoadSegments(dims[0], read); skipped > 0) {
+                        load_status_ = "Skipped " + std::to_string(skipped) + " zero-length segments";
+                    }
+                } catch (const std::exception &e) {
+                    load_status_ = "Failed to load " + std::string(path) + ": " + e.what();
+                }
             }
 
             void ComputeHull_() {
-                // TODO: This is gross, either create an interface or switch to SFML data structures
-                std::vector<math::Point2f> points;
-                PointList hull_list;
-                std::ranges::transform(shapes_, std::back_inserter(points), [](const auto &shape) -> math::Point2f {
-                    return {shape->getPosition().x, shape->getPosition().y};
-                });
-                const std::vector<math::Point2f> hull = alg::ConvexHull2D(points);
-                std::ranges::transform(hull, std::back_inserter(hull_list), [](const auto &point) -> std::array<float, 2> {
-                    return {point.x(), point.y()};
-                });
-                AddConvex_(hull_list);
+                const auto &points = scene_.Points();
+                const auto key = cache::ResultKey("hull", std::span<const math::Point2f>(points));
+                AddConvex_(hull_cache_.GetOrCompute(key, [&points] {
+                    return alg::ConvexHull2D(points);
+                }));
             }
 
             void ComputeIntersection_() {
-                // TODO: This is gross, either create an interface or switch to SFML data structures
-                std::vector<math::Line<float, 2>> lines;
-                std::ranges::transform(lines_, std::back_inserter(lines), [](const auto &line) -> math::Line<float, 2> {
-                    return {
-                        {line[0].position.x, line[0].position.y},
-                        {line[1].position.x, line[1].position.y},
-                        };
-                });
-                if (!lines[0].Intersects(lines[1])) return;
-                const math::Point2f intersection = math::GetIntersection(lines[0], lines[1]);
-                AddPoints_({{intersection.x() / kWidth, (kHeight - intersection.y()) / kHeight}});
+                scene_.AddPoints(alg::SegmentIntersections(scene_.Segments()));
             }
 
             void CreateAlgorithmBar(
@@ -111,7 +144,7 @@ namespace geom {
                     const std::vector<std::string_view> &filenames,
                     int& file_idx,
                     const std::function<void()>& algorithm,
-                    const std::function<void(const PointList&)>& data_adder
+                    const std::function<void(std::string_view)>& loader
                     ) {
                 if (ImGui::BeginTabItem(name.data())) {
                     const auto preview = (file_idx >= 0)
@@ -127,7 +160,7 @@ namespace geom {
                         }
                         ImGui::EndCombo();
                     }
-                    if (ImGui::Button("Generate data") && file_idx >= 0) LoadPoints_(filenames[file_idx], data_adder);
+                    if (ImGui::Button("Generate data") && file_idx >= 0) loader(filenames[file_idx]);
                     ImGui::SameLine();
                     if (ImGui::Button("Run")) algorithm();
                     ImGui::SameLine();
@@ -146,25 +179,40 @@ namespace geom {
                         {std::begin(convex_hull_data_files), std::end(convex_hull_data_files)},
                         convex_hull_points_,
                         [this] () {this->ComputeHull_();},
-                        [this] (const PointList& p) {this->AddPoints_(p);}
+                        [this] (const std::string_view path) {this->Load_(path, false);}
                         );
                     CreateAlgorithmBar(
                         "Line Segment Intersection",
                         {std::begin(line_segment_data_files), std::end(line_segment_data_files)},
                         line_segments_,
                         [this] () {this->ComputeIntersection_();},
-                        [this] (const PointList& p) {this->AddLines_(p);}
+                        [this] (const std::string_view path) {this->Load_(path, true);}
                         );
                     ImGui::EndTabBar();
                 }
+                const auto stats = hull_cache_.Stats();
+                ImGui::Text("Hull cache: %zu hits, %zu misses (%.0f%%)",
+                            stats.hits, stats.misses, stats.HitRate() * 100);
+                ImGui::Text("Drawing %zu pixels for %zu points, %zu segments",
+                            lod_.Cells(), lod_.Points(), scene_.Segments().size());
+                if (!load_status_.empty()) ImGui::TextUnformatted(load_status_.c_str());
+                if (stream_) {
+                    ImGui::Text("Stream: %zu points received, %zu queued, %zu hull vertices",
+                                stream_hull_.Count(), stream_->Size(), stream_hull_.Hull().size());
+                }
                 ImGui::End();
             }
 
             void Update() {
                 SetupImGui_();
+                PollStream_();
+                SyncLod_();
+                SyncLines_();
                 window_.clear();
-                for (const auto &line: lines_) window_.draw(line.data(), line.size(), sf::PrimitiveType::Lines);
+                window_.draw(lod_vertices_);
+                window_.draw(line_vertices_);
                 for (const auto &shape: shapes_) window_.draw(*shape);
+                window_.draw(stream_hull_shape_);
 
                 ImGui::SFML::Render(window_);
                 window_.display();
@@ -183,15 +231,33 @@ namespace geom {
             static constexpr int              kHeight                   = 640;
             static constexpr std::string_view convex_hull_data_files[]  = {"res/points"};
             static constexpr std::string_view line_segment_data_files[] = {"res/lines"};
+            static constexpr size_t           kStreamCapacity           = 1 << 20;
+            static constexpr size_t           kStreamBudget             = 1 << 18;
 
         private:
             std::vector<std::unique_ptr<sf::Shape> > shapes_;
-            std::vector<std::array<sf::Vertex, 2> > lines_;
 
             sf::RenderWindow window_;
             sf::Clock clock_;
             int convex_hull_points_;
             int line_segments_;
+            // Outcome of the last Load_ when it needs reporting, empty otherwise
+            std::string load_status_;
+
+            cache::ResultCache<std::vector<math::Point2f>> hull_cache_;
+
+            // The geometry, and the decimated view of its points that is actually drawn
+            Scene scene_;
+            ScreenDecimator lod_;
+            sf::VertexArray lod_vertices_ {sf::PrimitiveType::Points};
+            uint64_t lod_version_ = 0;
+            sf::VertexArray line_vertices_ {sf::PrimitiveType::Lines};
+            uint64_t lines_version_ = 0;
+
+            // Points streamed from another process, when attached
+            std::optional<ipc::PointRing> stream_;
+            alg::IncrementalHull stream_hull_;
+            sf::ConvexShape stream_hull_shape_;
         };
     }
 } // namespace geom
@@ -1,7 +1,23 @@
+#include <iostream>
+#include <string_view>
+
 #include "inc/viz/Window.h"
 using namespace geom::viz;
-int main() {
+int main(const int argc, char** argv) {
     auto renderer = Renderer();
+    // Points streamed by another process, see src/ingest/producer.cpp. A renderer that crashed
+    // leaves its ring's name taken; --reclaim removes it first.
+    const bool reclaim = argc > 1 && std::string_view(argv[1]) == "--reclaim";
+    if (const int ring = reclaim ? 2 : 1; ring < argc) {
+        try {
+            renderer.Attach(argv[ring], reclaim);
+        } catch (const std::exception& e) {
+            std::cerr << e.what() << "\n"
+                      << "usage: Geometry [--reclaim] [<ring-name>]; --reclaim replaces a stale ring "
+                      << "left by a renderer that did not exit cleanly\n";
+            return 1;
+        }
+    }
 
     while (renderer.IsRunning()) {
         renderer.HandleInputs();
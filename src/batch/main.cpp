@@ -0,0 +1,98 @@
+#include <chrono>
+#include <iostream>
+#include <mutex>
+
+#include <highfive/highfive.hpp>
+
+#include "../../inc/batch/Batch.hpp"
+#include "../../inc/cache/Hdf5Store.hpp"
+#include "../../inc/cache/ResultCache.hpp"
+#include "../../inc/exec/ThreadPool.hpp"
+
+using namespace geom;
+
+namespace {
+    double MsSince(const std::chrono::steady_clock::time_point start) {
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    // HDF5 reads and writes are serialised on cache::Hdf5Mutex while the geometry itself runs
+    // concurrently
+    batch::FileStats Process(const batch::Options& options, cache::ResultCache<batch::PointList>& results,
+                             const batch::Job& job) {
+        batch::FileStats stats {job.input, options.datasets.size() > 1 ? job.dataset : ""};
+        try {
+            auto start = std::chrono::steady_clock::now();
+            batch::PointList data;
+            {
+                std::lock_guard lock(cache::Hdf5Mutex());
+                const HighFive::File file(job.input.string(), HighFive::File::ReadOnly);
+                data = file.getDataSet(job.dataset).read<batch::PointList>();
+            }
+            stats.read_ms = MsSince(start);
+            stats.points = data.size();
+
+            start = std::chrono::steady_clock::now();
+            const auto key = cache::ResultKey(batch::AlgorithmName(options.algorithm),
+                                              std::span<const std::array<float, 2>>(data));
+            const auto cached = results.Find(key);
+            stats.cached = cached.has_value();
+            const batch::PointList result = cached ? *cached : batch::Run(options.algorithm, data);
+            if (!cached) results.Put(key, result);
+            stats.compute_ms = MsSince(start);
+            stats.results = result.size();
+
+            start = std::chrono::steady_clock::now();
+            {
+                std::lock_guard lock(cache::Hdf5Mutex());
+                HighFive::File file(job.output.string(), HighFive::File::Truncate);
+                auto dataset = file.createDataSet(std::string(batch::AlgorithmName(options.algorithm)), result);
+                dataset.createAttribute("source", job.input.string());
+                dataset.createAttribute("source_dataset", job.dataset);
+                dataset.createAttribute("source_points", stats.points);
+                dataset.createAttribute("compute_ms", stats.compute_ms);
+                dataset.createAttribute("points_per_second", stats.PointsPerSecond());
+            }
+            stats.write_ms = MsSince(start);
+        } catch (const std::exception& e) {
+            stats.error = e.what();
+        }
+        return stats;
+    }
+}
+
+int main(const int argc, char** argv) {
+    batch::Options options;
+    try {
+        options = batch::ParseArgs(std::vector<std::string_view>(argv + 1, argv + argc));
+    } catch (const std::exception& e) {
+        std::cerr << e.what() << "\n" << batch::kUsage;
+        return 2;
+    }
+
+    std::shared_ptr<cache::CacheStore<batch::PointList>> store;
+    try {
+        if (!options.cache_file.empty()) store = std::make_shared<cache::Hdf5Store>(options.cache_file);
+    } catch (const std::exception& e) {
+        std::cerr << "Cannot open cache " << options.cache_file << ": " << e.what() << "\n";
+        return 1;
+    }
+    cache::ResultCache<batch::PointList> results(256, store);
+
+    const auto start = std::chrono::steady_clock::now();
+    std::vector<batch::FileStats> stats;
+    {
+        exec::ThreadPool pool(exec::PoolConfig {options.jobs, {}});
+        std::vector<std::future<batch::FileStats>> pending;
+        for (const auto& job : batch::PlanJobs(options)) {
+            pending.push_back(pool.Submit([&options, &results, job] { return Process(options, results, job); }));
+        }
+        for (auto& future : pending) stats.push_back(future.get());
+    }
+
+    batch::PrintStats(std::cout, stats, MsSince(start));
+    const auto cache_stats = results.Stats();
+    std::cout << "cache: " << cache_stats.hits << " memory hits, " << cache_stats.disk_hits << " disk hits, "
+              << cache_stats.misses << " misses\n";
+    return std::ranges::any_of(stats, [](const auto& s) { return !s.error.empty(); }) ? 1 : 0;
+}
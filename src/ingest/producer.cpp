@@ -0,0 +1,31 @@
+#include <iostream>
+#include <random>
+#include <string>
+
+#include "../../inc/ipc/PointRing.hpp"
+
+using namespace geom;
+
+// Reference acquisition process: streams normally distributed points around the centre of the
+// unit square into a ring created by a consumer such as the Renderer, e.g. `Geometry /points` and `geometry_producer /points`
+int main(const int argc, char** argv) {
+    if (argc < 2) {
+        std::cerr << "usage: geometry_producer <ring-name> [points] [batch]\n";
+        return 2;
+    }
+    try {
+        const size_t count = argc > 2 ? std::stoul(argv[2]) : 1000000;
+        const size_t batch = argc > 3 ? std::stoul(argv[3]) : 4096;
+        auto ring = ipc::PointRing::Open(argv[1]);
+
+        std::mt19937 rng(std::random_device {}());
+        // The square's edges lie over four deviations from the mean, so few points fall outside it
+        std::normal_distribution<float> spread(0.5, 0.12);
+        ipc::Produce(ring, count, batch, [&](const std::span<math::Point2f> slots, size_t) {
+            for (auto& p : slots) p = {spread(rng), spread(rng)};
+        });
+    } catch (const std::exception& e) {
+        std::cerr << e.what() << "\n";
+        return 1;
+    }
+}
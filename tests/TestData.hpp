@@ -0,0 +1,32 @@
+#ifndef CPPGEOMETRY_TEST_DATA_HPP
+#define CPPGEOMETRY_TEST_DATA_HPP
+
+#include <random>
+#include <vector>
+
+#include "../inc/math/Point.hpp"
+
+// Random inputs shared by the tests, the same on every run for the same seed
+namespace geom::test {
+    // n points uniform over the square [low, high)^2
+    inline std::vector<math::Point2f> RandomPoints(const size_t n, const unsigned seed, const float low = 0, const float high = 1) {
+        std::mt19937 rng(seed);
+        std::uniform_real_distribution<float> dist(low, high);
+        std::vector<math::Point2f> points;
+        points.reserve(n);
+        for (size_t i = 0; i < n; i++) points.emplace_back(dist(rng), dist(rng));
+        return points;
+    }
+
+    // n points from a normal distribution around the origin, with the given spread along each axis
+    inline std::vector<math::Point2f> NormalPoints(const size_t n, const unsigned seed, const float sx = 1, const float sy = 1) {
+        std::mt19937 rng(seed);
+        std::normal_distribution<float> dist(0.0, 1.0);
+        std::vector<math::Point2f> points;
+        points.reserve(n);
+        for (size_t i = 0; i < n; i++) points.emplace_back(sx * dist(rng), sy * dist(rng));
+        return points;
+    }
+} // namespace geom::test
+
+#endif // CPPGEOMETRY_TEST_DATA_HPP
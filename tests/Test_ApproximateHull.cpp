@@ -0,0 +1,77 @@
+#include "gtest/gtest.h"
+#include "../inc/alg/ApproximateHull.hpp"
+#include "../inc/alg/ConvexHull.hpp"
+#include "../inc/alg/RotatingCalipers.hpp"
+#include "TestData.hpp"
+
+namespace g_alg = geom::alg;
+namespace g_exec = geom::exec;
+namespace g_math = geom::math;
+namespace g_test = geom::test;
+
+namespace {
+    // Distance from p to a closed counter-clockwise hull, zero inside
+    float Distance(const std::vector<g_math::Point2f>& hull, const g_math::Point2f& p) {
+        bool inside = true;
+        float nearest = std::numeric_limits<float>::max();
+        for (size_t i = 0; i + 1 < hull.size(); i++) {
+            const auto edge = hull[i + 1] - hull[i];
+            const auto offset = p - hull[i];
+            if (g_math::Cross2D(edge, offset) < 0) inside = false;
+            const float t = std::clamp<float>(g_math::Dot(offset, edge) / g_math::Dot(edge, edge), 0, 1);
+            nearest = std::min(nearest, (offset - edge * t).Norm());
+        }
+        return inside ? 0 : nearest;
+    }
+} // namespace
+
+TEST(ApproximateHullTest, WithinErrorOfExactHull) {
+    constexpr float kEpsilon = 0.01;
+    const auto points = g_test::NormalPoints(100000, 3, 3);
+    const auto exact = g_alg::ConvexHull2D(points);
+    const auto sketch = g_alg::ApproximateHull(points, kEpsilon);
+    const auto approximate = sketch.Hull();
+
+    const float diameter = g_alg::Diameter(exact).distance;
+    EXPECT_LE(sketch.ErrorBound(), kEpsilon * diameter);
+    EXPECT_LE(approximate.size(), sketch.Directions() + 1) << "Memory should be bounded by the direction count";
+    for (const auto& p : exact) {
+        EXPECT_LE(Distance(approximate, p), sketch.ErrorBound() + 1e-4) << p;
+    }
+    for (const auto& p : approximate) {
+        EXPECT_LE(Distance(exact, p), 1e-4) << "Sketch vertices should be input points on the true hull";
+    }
+}
+
+TEST(ApproximateHullTest, MergeMatchesSingleStream) {
+    const auto points = g_test::NormalPoints(20000, 3, 3);
+    g_alg::HullSketch whole(0.02), left(0.02), right(0.02);
+    whole.Add(points);
+    left.Add(std::vector(points.begin(), points.begin() + 7000));
+    right.Add(std::vector(points.begin() + 7000, points.end()));
+    left.Merge(right);
+
+    EXPECT_EQ(left.Count(), points.size());
+    EXPECT_EQ(left.Hull(), whole.Hull());
+}
+
+TEST(ApproximateHullTest, ParallelMatchesSequential) {
+    const auto points = g_test::NormalPoints(200000, 3, 3);
+    g_exec::ThreadPool pool(g_exec::PoolConfig {4, {}});
+    EXPECT_EQ(g_alg::ApproximateHull(g_exec::par.On(pool), points, 0.01).Hull(), g_alg::ApproximateHull(points, 0.01).Hull());
+}
+
+TEST(ApproximateHullTest, SmallInputs) {
+    g_alg::HullSketch sketch(0.05);
+    EXPECT_TRUE(sketch.Hull().empty());
+    sketch.Add({1.0, 2.0});
+    EXPECT_EQ(sketch.Hull().size(), 2) << "A single point closes on itself";
+    EXPECT_FLOAT_EQ(sketch.ErrorBound(), 0);
+}
+
+TEST(ApproximateHullTest, RejectsBadEpsilon) {
+    EXPECT_THROW(g_alg::HullSketch(0), std::runtime_error);
+    g_alg::HullSketch fine(0.01), coarse(0.1);
+    EXPECT_LT(coarse.Directions(), fine.Directions());
+    EXPECT_THROW(fine.Merge(coarse), std::runtime_error);
+}
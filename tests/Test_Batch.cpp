@@ -0,0 +1,79 @@
+#include "gtest/gtest.h"
+#include "../inc/batch/Batch.hpp"
+
+namespace g_batch = geom::batch;
+
+TEST(BatchTest, ParseArgs) {
+    const auto got = g_batch::ParseArgs({"--algorithm", "closest-pair", "--jobs", "3", "--output-dir", "out", "a.h5", "b.h5"});
+    EXPECT_EQ(got.algorithm, g_batch::Algorithm::CLOSEST_PAIR);
+    EXPECT_EQ(got.jobs, 3);
+    EXPECT_EQ(got.datasets, std::vector<std::string> {"points"});
+    ASSERT_EQ(got.inputs.size(), 2);
+    const auto jobs = g_batch::PlanJobs(got);
+    ASSERT_EQ(jobs.size(), 2);
+    EXPECT_EQ(jobs[1].output, std::filesystem::path("out/b_closest-pair.h5"));
+    EXPECT_TRUE(got.cache_file.empty()) << "Disk cache should be off by default";
+
+    const auto cached = g_batch::ParseArgs({"--algorithm", "hull", "--cache", "results.h5", "a.h5"});
+    EXPECT_EQ(cached.cache_file, std::filesystem::path("results.h5"));
+}
+
+TEST(BatchTest, ParseArgsRejectsBadInput) {
+    EXPECT_THROW(g_batch::ParseArgs({"a.h5"}), std::invalid_argument) << "Algorithm should be required";
+    EXPECT_THROW(g_batch::ParseArgs({"--algorithm", "hull"}), std::invalid_argument) << "Inputs should be required";
+    EXPECT_THROW(g_batch::ParseArgs({"--algorithm", "triangulate", "a.h5"}), std::invalid_argument);
+    EXPECT_THROW(g_batch::ParseArgs({"--algorithm"}), std::invalid_argument);
+}
+
+TEST(BatchTest, ParseArgsRejectsBadJobs) {
+    for (const std::string_view jobs : {"-1", "0", "4x", "abc", "", "99999999999999999999"}) {
+        EXPECT_THROW(g_batch::ParseArgs({"--algorithm", "hull", "--jobs", jobs, "a.h5"}), std::invalid_argument) << "--jobs " << jobs;
+    }
+    EXPECT_EQ(g_batch::ParseArgs({"--algorithm", "hull", "--jobs", "4", "a.h5"}).jobs, 4);
+}
+
+TEST(BatchTest, PlanJobsForSeveralDatasets) {
+    const auto options = g_batch::ParseArgs({"--algorithm", "hull", "--dataset", "points", "--dataset", "lines", "in/a.h5"});
+    const auto jobs = g_batch::PlanJobs(options);
+    ASSERT_EQ(jobs.size(), 2);
+    EXPECT_EQ(jobs[0].dataset, "points");
+    EXPECT_EQ(jobs[0].output, std::filesystem::path("in/a_points_hull.h5"));
+    EXPECT_EQ(jobs[1].dataset, "lines");
+    EXPECT_EQ(jobs[1].output, std::filesystem::path("in/a_lines_hull.h5"));
+}
+
+TEST(BatchTest, PlanJobsKeepsOutputsApart) {
+    const auto options = g_batch::ParseArgs({"--algorithm", "hull", "--output-dir", "out", "a/x.h5", "b/x.h5", "c/x.h5"});
+    const auto jobs = g_batch::PlanJobs(options);
+    ASSERT_EQ(jobs.size(), 3);
+    EXPECT_EQ(jobs[0].output, std::filesystem::path("out/x_hull.h5"));
+    EXPECT_EQ(jobs[1].output, std::filesystem::path("out/x_2_hull.h5"));
+    EXPECT_EQ(jobs[2].output, std::filesystem::path("out/x_3_hull.h5"));
+
+    const auto separate = g_batch::PlanJobs(g_batch::ParseArgs({"--algorithm", "hull", "a/x.h5", "b/x.h5"}));
+    EXPECT_EQ(separate[1].output, std::filesystem::path("b/x_hull.h5")) << "Outputs next to their inputs do not collide";
+}
+
+TEST(BatchTest, RunRejectsTooFewPoints) {
+    const g_batch::PointList two {{0.0, 0.0}, {1.0, 1.0}};
+    EXPECT_THROW(g_batch::Run(g_batch::Algorithm::HULL, {}), std::runtime_error);
+    EXPECT_THROW(g_batch::Run(g_batch::Algorithm::DIAMETER, two), std::runtime_error);
+    EXPECT_THROW(g_batch::Run(g_batch::Algorithm::MIN_AREA_RECTANGLE, two), std::runtime_error);
+    EXPECT_THROW(g_batch::Run(g_batch::Algorithm::CLOSEST_PAIR, {{0.0, 0.0}}), std::runtime_error);
+    EXPECT_EQ(g_batch::Run(g_batch::Algorithm::CLOSEST_PAIR, two).size(), 2);
+}
+
+TEST(BatchTest, RunHull) {
+    const g_batch::PointList square {{0.0, 0.0}, {1.0, 0.0}, {1.0, 1.0}, {0.0, 1.0}, {0.5, 0.5}};
+    const auto got = g_batch::Run(g_batch::Algorithm::HULL, square);
+    EXPECT_EQ(got.size(), 5) << "Hull of a square should be its four corners plus the closing vertex";
+}
+
+TEST(BatchTest, RunIntersection) {
+    // Two crossing segments and one far away, as consecutive point pairs
+    const g_batch::PointList lines {{0.0, 0.0}, {2.0, 2.0}, {0.0, 2.0}, {2.0, 0.0}, {5.0, 5.0}, {6.0, 5.0}};
+    const auto got = g_batch::Run(g_batch::Algorithm::INTERSECTION, lines);
+    ASSERT_EQ(got.size(), 1);
+    EXPECT_FLOAT_EQ(got[0][0], 1.0);
+    EXPECT_FLOAT_EQ(got[0][1], 1.0);
+}
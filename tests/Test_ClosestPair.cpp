@@ -0,0 +1,64 @@
+#include "gtest/gtest.h"
+#include "../inc/alg/ClosestPair.hpp"
+#include "TestData.hpp"
+
+namespace g_alg = geom::alg;
+namespace g_exec = geom::exec;
+namespace g_math = geom::math;
+namespace g_test = geom::test;
+
+namespace {
+    float BruteForceClosest(const std::vector<g_math::Point2f>& points) {
+        float best = std::numeric_limits<float>::max();
+        for (size_t i = 0; i < points.size(); i++)
+            for (size_t j = i + 1; j < points.size(); j++) best = std::min(best, g_math::SquaredDistance(points[i], points[j]));
+        return std::sqrt(best);
+    }
+} // namespace
+
+TEST(ClosestPairTest, SmallSet) {
+    const auto got = g_alg::ClosestPair({{0.0, 0.0}, {5.0, 5.0}, {1.0, 0.0}, {5.2, 5.1}, {3.0, 3.0}});
+    EXPECT_NEAR(got.distance, std::sqrt(0.05f), 1e-6) << "Closest pair should be {5, 5} and {5.2, 5.1}";
+}
+
+TEST(ClosestPairTest, DuplicatesHaveZeroDistance) {
+    const auto got = g_alg::ClosestPair({{0.0, 0.0}, {1.0, 1.0}, {2.0, 0.0}, {1.0, 1.0}});
+    EXPECT_FLOAT_EQ(got.distance, 0.0);
+    EXPECT_EQ(got.first, g_math::Point2f(1.0, 1.0));
+}
+
+TEST(ClosestPairTest, MatchesBruteForce) {
+    for (const unsigned seed : {1u, 2u, 3u}) {
+        const auto points = g_test::RandomPoints(2000, seed);
+        const float expected = BruteForceClosest(points);
+        EXPECT_FLOAT_EQ(g_alg::ClosestPair(points).distance, expected);
+    }
+}
+
+TEST(ClosestPairTest, ParallelMatchesSequential) {
+    const auto points = g_test::RandomPoints(300000, 13);
+    const auto expected = g_alg::ClosestPair(points);
+    g_exec::ThreadPool pool(g_exec::PoolConfig {4, {}});
+    const auto got = g_alg::ClosestPair(g_exec::par.On(pool), points);
+    EXPECT_FLOAT_EQ(got.distance, expected.distance);
+}
+
+TEST(ClosestPairTest, NearestNeighboursMatchBruteForce) {
+    const auto points = g_test::RandomPoints(1500, 13);
+    g_exec::ThreadPool pool(g_exec::PoolConfig {4, {}});
+    const auto got = g_alg::AllNearestNeighbours(g_exec::par.On(pool), points);
+    ASSERT_EQ(got.size(), points.size());
+    for (size_t i = 0; i < points.size(); i++) {
+        float expected = std::numeric_limits<float>::max();
+        for (size_t j = 0; j < points.size(); j++) {
+            if (j != i) expected = std::min(expected, g_math::SquaredDistance(points[i], points[j]));
+        }
+        ASSERT_NE(got[i], i) << "Point " << i << " cannot be its own neighbour";
+        EXPECT_FLOAT_EQ(g_math::SquaredDistance(points[i], points[got[i]]), expected) << "Wrong neighbour for point " << i;
+    }
+}
+
+TEST(ClosestPairTest, TooFewPointsThrow) {
+    EXPECT_THROW(g_alg::ClosestPair({{0.0, 0.0}}), std::runtime_error);
+    EXPECT_THROW(g_alg::AllNearestNeighbours({{0.0, 0.0}}), std::runtime_error);
+}
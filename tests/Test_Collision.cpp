@@ -0,0 +1,147 @@
+#include "gtest/gtest.h"
+#include "../inc/alg/Collision.hpp"
+#include "../inc/alg/ConvexHull.hpp"
+#include "TestData.hpp"
+
+#include <random>
+
+namespace g_alg = geom::alg;
+namespace g_exec = geom::exec;
+namespace g_math = geom::math;
+namespace g_test = geom::test;
+
+namespace {
+    std::vector<g_math::Point2f> Box(const float x0, const float y0, const float x1, const float y1) {
+        return {{x0, y0}, {x1, y0}, {x1, y1}, {x0, y1}};
+    }
+
+    // Hulls of small random clouds scattered over a square, so that some of them overlap
+    std::vector<std::vector<g_math::Point2f>> RandomHulls(const size_t n, const float extent, const unsigned seed = 5) {
+        std::mt19937 rng(seed);
+        std::uniform_real_distribution<float> centre(0, extent);
+        std::vector<std::vector<g_math::Point2f>> hulls;
+        for (size_t i = 0; i < n; i++) {
+            const g_math::Point2f c {centre(rng), centre(rng)};
+            auto cloud = g_test::RandomPoints(12, rng(), -1, 1);
+            for (auto& p : cloud) p = c + p;
+            hulls.push_back(g_alg::ConvexHull2D(cloud));
+        }
+        return hulls;
+    }
+} // namespace
+
+TEST(CollisionTest, MinkowskiSumOfBoxes) {
+    const auto sum = g_alg::MinkowskiSum(Box(0, 0, 1, 1), Box(2, 3, 4, 4));
+    const std::vector<g_math::Point2f> expected {{2, 3}, {5, 3}, {5, 5}, {2, 5}};
+    EXPECT_EQ(sum, expected) << "Parallel edges should merge into one";
+}
+
+TEST(CollisionTest, MinkowskiSumMatchesHullOfPairwiseSums) {
+    const auto hulls = RandomHulls(20, 10);
+    for (size_t i = 0; i + 1 < hulls.size(); i++) {
+        std::vector<g_math::Point2f> sums;
+        for (const auto& p : hulls[i]) {
+            for (const auto& q : hulls[i + 1]) sums.push_back(p + q);
+        }
+        const auto expected = g_alg::ConvexHull2D(sums);
+        const auto sum = g_alg::MinkowskiSum(hulls[i], hulls[i + 1]);
+        EXPECT_NEAR(std::abs(g_alg::SignedArea2(sum)), std::abs(g_alg::SignedArea2({expected.begin(), expected.end() - 1})), 1e-3);
+        EXPECT_GT(g_alg::SignedArea2(sum), 0) << "Sum should be counter-clockwise";
+    }
+}
+
+TEST(CollisionTest, DistanceOfSeparatedBoxes) {
+    const auto proximity = g_alg::ConvexDistance(Box(0, 0, 1, 1), Box(3, 0.5, 4, 2));
+    EXPECT_FALSE(proximity.overlap);
+    EXPECT_NEAR(proximity.distance, 2, 1e-5);
+    EXPECT_NEAR(proximity.closest_a.x(), 1, 1e-5);
+    EXPECT_NEAR(proximity.closest_b.x(), 3, 1e-5);
+    EXPECT_FALSE(g_alg::PenetrationDepth(Box(0, 0, 1, 1), Box(3, 0.5, 4, 2)).has_value());
+}
+
+TEST(CollisionTest, DistanceBetweenCorners) {
+    const auto proximity = g_alg::ConvexDistance(Box(0, 0, 1, 1), Box(2, 2, 3, 3));
+    EXPECT_NEAR(proximity.distance, std::sqrt(2.0f), 1e-5);
+    EXPECT_EQ(proximity.closest_a, g_math::Point2f(1, 1));
+    EXPECT_EQ(proximity.closest_b, g_math::Point2f(2, 2));
+}
+
+TEST(CollisionTest, PenetrationOfOverlappingBoxes) {
+    const auto a = Box(0, 0, 1, 1);
+    const auto b = Box(0.8, 0, 1.8, 1);
+    EXPECT_TRUE(g_alg::ConvexDistance(a, b).overlap);
+
+    const auto penetration = g_alg::PenetrationDepth(a, b);
+    ASSERT_TRUE(penetration.has_value());
+    EXPECT_NEAR(penetration->depth, 0.2, 1e-5);
+    EXPECT_NEAR(penetration->normal.x(), 1, 1e-5);
+    EXPECT_NEAR(penetration->normal.y(), 0, 1e-5);
+}
+
+TEST(CollisionTest, ClosedHullsAreAccepted) {
+    auto a = Box(0, 0, 1, 1);
+    a.push_back(a.front());
+    const auto penetration = g_alg::PenetrationDepth(a, Box(0.5, 0.9, 1.5, 1.5));
+    ASSERT_TRUE(penetration.has_value());
+    EXPECT_NEAR(penetration->depth, 0.1, 1e-5);
+    EXPECT_NEAR(penetration->normal.y(), 1, 1e-5);
+}
+
+TEST(CollisionTest, SeparationByPenetrationVector) {
+    const auto hulls = RandomHulls(200, 15);
+    for (size_t i = 0; i + 1 < hulls.size(); i++) {
+        const auto penetration = g_alg::PenetrationDepth(hulls[i], hulls[i + 1]);
+        if (!penetration) continue;
+        auto moved = hulls[i + 1];
+        for (auto& p : moved) p = p + penetration->normal * (penetration->depth + 1e-3f);
+        EXPECT_FALSE(g_alg::ConvexDistance(hulls[i], moved).overlap) << "Pair " << i;
+    }
+}
+
+TEST(CollisionTest, ContactsMatchBruteForce) {
+    const auto hulls = RandomHulls(2000, 100);
+    std::vector<std::pair<size_t, size_t>> expected;
+    for (size_t i = 0; i < hulls.size(); i++) {
+        for (size_t j = i + 1; j < hulls.size(); j++) {
+            if (g_alg::ConvexDistance(hulls[i], hulls[j]).overlap) expected.emplace_back(i, j);
+        }
+    }
+    ASSERT_FALSE(expected.empty());
+
+    for (const auto& contacts : {g_alg::FindContacts(hulls), g_alg::FindContacts(g_exec::par, hulls)}) {
+        std::vector<std::pair<size_t, size_t>> pairs;
+        for (const auto& contact : contacts) pairs.emplace_back(contact.first, contact.second);
+        EXPECT_EQ(pairs, expected);
+    }
+}
+
+TEST(CollisionTest, ScaleInvariant) {
+    for (const float s : {1e-4f, 1e-3f, 1e3f}) {
+        SCOPED_TRACE(testing::Message() << "scale " << s);
+        const auto penetration = g_alg::PenetrationDepth(Box(0, 0, s, s), Box(0.8f * s, 0.1f * s, 1.8f * s, 1.1f * s));
+        ASSERT_TRUE(penetration.has_value()) << "Overlapping boxes should collide at any scale";
+        EXPECT_NEAR(penetration->depth, 0.2f * s, 1e-4f * s);
+        EXPECT_NEAR(penetration->normal.x(), 1, 1e-4);
+
+        const auto proximity = g_alg::ConvexDistance(Box(0, 0, s, s), Box(1.5f * s, 0.5f * s, 2.5f * s, 2 * s));
+        EXPECT_FALSE(proximity.overlap);
+        EXPECT_NEAR(proximity.distance, 0.5f * s, 1e-4f * s);
+    }
+}
+
+TEST(CollisionTest, ContactsOfSmallHulls) {
+    // The same scene shrunk a thousandfold has the same contacts
+    auto hulls = RandomHulls(200, 15);
+    const auto expected = g_alg::FindContacts(hulls);
+    ASSERT_FALSE(expected.empty());
+    for (auto& hull : hulls) {
+        for (auto& p : hull) p = {p.x() * 1e-3f, p.y() * 1e-3f};
+    }
+    const auto got = g_alg::FindContacts(hulls);
+    ASSERT_EQ(got.size(), expected.size());
+    for (size_t i = 0; i < got.size(); i++) {
+        EXPECT_EQ(got[i].first, expected[i].first);
+        EXPECT_EQ(got[i].second, expected[i].second);
+        EXPECT_NEAR(got[i].penetration.depth, expected[i].penetration.depth * 1e-3f, 1e-3f * 1e-3f);
+    }
+}
@@ -0,0 +1,57 @@
+#include "gtest/gtest.h"
+#include "../inc/viz/Decimation.hpp"
+#include "TestData.hpp"
+
+namespace g_viz = geom::viz;
+namespace g_math = geom::math;
+namespace g_test = geom::test;
+
+TEST(DecimationTest, OneRepresentativePerCell) {
+    g_viz::ScreenDecimator lod(4, 4);
+    const std::vector<g_math::Point2f> points {{0.2, 0.2}, {0.7, 0.9}, {3.5, 3.5}, {1.5, 0.5}};
+    lod.Add(points);
+
+    EXPECT_EQ(lod.Cells(), 3) << "The first two points share a pixel";
+    EXPECT_EQ(lod.MaxCount(), 2);
+    EXPECT_EQ(lod.Points(), 4);
+
+    std::vector<g_math::Point2f> representatives;
+    lod.ForEachCell([&](const g_math::Point2f& p, uint32_t) { representatives.push_back(p); });
+    EXPECT_EQ(representatives[0], points[0]) << "A cell is represented by its first point";
+}
+
+TEST(DecimationTest, BoundedByScreenSize) {
+    constexpr size_t kSize = 64;
+    g_viz::ScreenDecimator lod(kSize, kSize, 2);
+    const auto points = g_test::RandomPoints(100000, 1, 0, kSize);
+    lod.Add(points);
+
+    EXPECT_LE(lod.Cells(), (kSize / 2) * (kSize / 2));
+    size_t total = 0;
+    lod.ForEachCell([&](const g_math::Point2f&, const uint32_t count) { total += count; });
+    EXPECT_EQ(total, points.size()) << "Counts should account for every point";
+}
+
+TEST(DecimationTest, IncrementalAddAndClear) {
+    g_viz::ScreenDecimator lod(8, 8);
+    const auto version = lod.Version();
+    lod.Add(std::vector<g_math::Point2f> {{1.0, 1.0}});
+    EXPECT_NE(lod.Version(), version) << "Adding points should invalidate the renderer's vertices";
+    lod.Add(std::vector<g_math::Point2f> {{2.0, 2.0}, {-1.0, 2.0}, {2.0, 9.0}});
+    EXPECT_EQ(lod.Cells(), 2);
+    EXPECT_EQ(lod.Culled(), 2) << "Off-screen points should be culled";
+
+    lod.Clear();
+    EXPECT_EQ(lod.Cells(), 0);
+    EXPECT_EQ(lod.MaxCount(), 0);
+    lod.Add(std::vector<g_math::Point2f> {{1.0, 1.0}});
+    EXPECT_EQ(lod.MaxCount(), 1) << "Clear should reset the counts of previously occupied cells";
+}
+
+TEST(DecimationTest, RejectsEmptyScreen) {
+    EXPECT_THROW(g_viz::ScreenDecimator(0, 10), std::runtime_error);
+    EXPECT_THROW(g_viz::ScreenDecimator(10, 10, 0), std::runtime_error);
+    EXPECT_THROW(g_viz::ScreenDecimator(10, 10, -1), std::runtime_error);
+    EXPECT_THROW(g_viz::ScreenDecimator(10, 10, std::numeric_limits<float>::quiet_NaN()), std::runtime_error);
+    EXPECT_THROW(g_viz::ScreenDecimator(10, 10, std::numeric_limits<float>::infinity()), std::runtime_error);
+}
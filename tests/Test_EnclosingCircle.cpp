@@ -0,0 +1,61 @@
+#include "gtest/gtest.h"
+#include "../inc/alg/ConvexHull.hpp"
+#include "../inc/alg/EnclosingCircle.hpp"
+#include "TestData.hpp"
+
+#include <random>
+
+namespace g_alg = geom::alg;
+namespace g_math = geom::math;
+namespace g_test = geom::test;
+
+TEST(EnclosingCircleTest, SinglePoint) {
+    const auto got = g_alg::MinimumEnclosingCircle({{1.0, 2.0}});
+    EXPECT_EQ(got.center, g_math::Point2f(1.0, 2.0));
+    EXPECT_FLOAT_EQ(got.radius, 0.0);
+}
+
+TEST(EnclosingCircleTest, Square) {
+    const auto got = g_alg::MinimumEnclosingCircle({{0.0, 0.0}, {2.0, 0.0}, {2.0, 2.0}, {0.0, 2.0}, {1.0, 1.0}});
+    EXPECT_EQ(got.center, g_math::Point2f(1.0, 1.0)) << "Center should be {1, 1} but got " << got.center;
+    EXPECT_FLOAT_EQ(got.radius, std::sqrt(2.0f));
+}
+
+TEST(EnclosingCircleTest, ObtuseTriangleUsesLongestSide) {
+    const auto got = g_alg::MinimumEnclosingCircle({{0.0, 0.0}, {4.0, 0.0}, {2.0, 0.5}});
+    EXPECT_EQ(got.center, g_math::Point2f(2.0, 0.0)) << "Center should be {2, 0} but got " << got.center;
+    EXPECT_FLOAT_EQ(got.radius, 2.0);
+}
+
+TEST(EnclosingCircleTest, HullGivesSameCircle) {
+    const auto points = g_test::RandomPoints(1000, 7, -1, 1);
+
+    const auto from_points = g_alg::MinimumEnclosingCircle(points);
+    const auto from_hull = g_alg::MinimumEnclosingCircle(g_alg::ConvexHull2D(points));
+    EXPECT_NEAR(from_points.radius, from_hull.radius, 1e-5);
+    for (const auto& p : points) EXPECT_TRUE(from_hull.Contains(p)) << p << " lies outside the circle";
+}
+
+TEST(EnclosingCircleTest, RepeatableAndSeedable) {
+    const auto points = g_test::RandomPoints(500, 11, -1, 1);
+
+    const auto first = g_alg::MinimumEnclosingCircle(points);
+    const auto second = g_alg::MinimumEnclosingCircle(points);
+    EXPECT_EQ(first.center, second.center) << "The default shuffle should be the same on every call";
+    EXPECT_EQ(first.radius, second.radius);
+
+    const auto seeded = g_alg::MinimumEnclosingCircle(points, std::mt19937(3));
+    EXPECT_NEAR(seeded.radius, first.radius, 1e-5);
+}
+
+TEST(EnclosingCircleTest, ScaleInvariant) {
+    for (const float s : {1e-4f, 1e-3f, 1e3f}) {
+        SCOPED_TRACE(testing::Message() << "scale " << s);
+        const std::vector<g_math::Point2f> triangle {{0, 0}, {s, 0}, {0.5f * s, 0.8f * s}};
+        const auto got = g_alg::MinimumEnclosingCircle(triangle);
+        // Circumcircle of the acute triangle, centred on x = s / 2
+        EXPECT_NEAR(got.center.x(), 0.5f * s, 1e-5f * s);
+        EXPECT_NEAR(got.radius, 0.55625f * s, 1e-5f * s);
+        for (const auto& p : triangle) EXPECT_TRUE(got.Contains(p)) << p << " lies outside the circle";
+    }
+}
@@ -0,0 +1,105 @@
+#include "gtest/gtest.h"
+#include "../inc/alg/ConvexHull.hpp"
+#include "../inc/exec/Policy.hpp"
+#include "TestData.hpp"
+
+#include <memory>
+#include <numeric>
+#include <random>
+
+namespace g_alg = geom::alg;
+namespace g_exec = geom::exec;
+namespace g_math = geom::math;
+namespace g_test = geom::test;
+
+class ExecFixture : public ::testing::Test {
+    public:
+        g_exec::ThreadPool pool {g_exec::PoolConfig {4, {}}};
+};
+
+TEST_F(ExecFixture, SubmitReturnsResult) {
+    auto future = pool.Submit([] { return 42; });
+    EXPECT_EQ(future.get(), 42);
+    EXPECT_EQ(pool.Size(), 4);
+}
+
+TEST_F(ExecFixture, NestedGroupsComplete) {
+    std::atomic<int> count {0};
+    g_exec::TaskGroup outer(pool);
+    for (int i = 0; i < 16; i++) {
+        outer.Run([this, &count] {
+            g_exec::TaskGroup inner(pool);
+            for (int j = 0; j < 16; j++) inner.Run([&count] { count++; });
+            inner.Wait();
+        });
+    }
+    outer.Wait();
+    EXPECT_EQ(count, 256) << "Every nested task should have run exactly once";
+}
+
+TEST_F(ExecFixture, GroupRethrows) {
+    g_exec::TaskGroup group(pool);
+    group.Run([] { throw std::runtime_error("boom"); });
+    EXPECT_THROW(group.Wait(), std::runtime_error);
+}
+
+TEST_F(ExecFixture, ForEachBlockCoversRange) {
+    std::vector<int> hits(100000, 0);
+    g_exec::ForEachBlock(g_exec::par.On(pool), hits.size(), 1000, [&hits](const size_t begin, const size_t end) {
+        for (size_t i = begin; i < end; i++) hits[i]++;
+    });
+    EXPECT_TRUE(std::ranges::all_of(hits, [](const int h) { return h == 1; }));
+}
+
+TEST_F(ExecFixture, ParallelOrderMatchesSequential) {
+    auto expected = g_test::RandomPoints(200000, 11);
+    auto got = expected;
+    g_math::LexicographicOrder(expected);
+    g_math::LexicographicOrder(g_exec::par.On(pool), got);
+    ASSERT_EQ(got.size(), expected.size());
+    for (size_t i = 0; i < got.size(); i++) ASSERT_EQ(got[i], expected[i]) << "Order differs at " << i;
+}
+
+TEST_F(ExecFixture, ParallelHullMatchesSequential) {
+    // Integer predicates are exact, so block order cannot change which vertices survive
+    std::mt19937 rng(5);
+    std::uniform_int_distribution<int32_t> dist(-1000000, 1000000);
+    std::vector<g_math::Point2i> points;
+    for (size_t i = 0; i < 500000; i++) points.emplace_back(dist(rng), dist(rng));
+
+    const auto expected = g_alg::ConvexHull2D(points);
+    for (const auto& got : {g_alg::ConvexHull2D(g_exec::par.On(pool), points),
+                            g_alg::ConvexHull2D(g_exec::par_unseq.On(pool), points),
+                            g_alg::ConvexHull2D(g_exec::seq, points)}) {
+        ASSERT_EQ(got.size(), expected.size());
+        for (size_t i = 0; i < got.size(); i++) EXPECT_EQ(got[i], expected[i]) << "Hull vertex " << i << " differs";
+    }
+}
+
+TEST_F(ExecFixture, ParallelHullEnclosesPoints) {
+    const auto points = g_test::RandomPoints(500000, 11);
+    const auto hull = g_alg::ConvexHull2D(g_exec::par.On(pool), points);
+    for (size_t i = 0; i < points.size(); i += 97) {
+        for (size_t j = 0; j + 1 < hull.size(); j++) {
+            ASSERT_NE(g_math::Orientation2d(hull[j], hull[j + 1], points[i]), g_math::Orientation::NEGATIVE)
+                << points[i] << " lies outside the hull";
+        }
+    }
+}
+
+TEST(ExecTest, PinnedPoolRuns) {
+    std::unique_ptr<g_exec::ThreadPool> pool;
+    try {
+        pool = std::make_unique<g_exec::ThreadPool>(g_exec::PoolConfig {2, {0}});
+    } catch (const std::runtime_error&) {
+        GTEST_SKIP() << "CPU 0 is not available to this process";
+    }
+    EXPECT_EQ(pool->Submit([] { return 1; }).get(), 1);
+}
+
+#ifdef __linux__
+TEST(ExecTest, FailedPinningThrowsCleanly) {
+    EXPECT_THROW(g_exec::ThreadPool(g_exec::PoolConfig {2, {1023}}), std::runtime_error)
+        << "Started workers should be joined before the error propagates";
+}
+#endif
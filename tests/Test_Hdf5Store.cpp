@@ -0,0 +1,56 @@
+#include "gtest/gtest.h"
+#include "../inc/cache/Hdf5Store.hpp"
+
+#include <filesystem>
+
+namespace g_cache = geom::cache;
+
+namespace {
+    typedef std::vector<std::array<float, 2>> PointList;
+
+    // A fresh cache file per test, removed again on scope exit
+    struct TempFile {
+        std::filesystem::path path;
+
+        explicit TempFile(const std::string& name) : path(std::filesystem::temp_directory_path() / name) {
+            std::filesystem::remove(path);
+        }
+
+        ~TempFile() { std::filesystem::remove(path); }
+    };
+}
+
+TEST(Hdf5StoreTest, RoundTrips) {
+    const TempFile file("cppgeometry_store_roundtrip.h5");
+    const PointList hull {{0, 0}, {1, 0}, {0.5f, 1}};
+    const PointList input {{0, 0}, {1, 0}, {0.5f, 1}, {0.5f, 0.5f}};
+    const auto key = g_cache::ResultKey("hull", std::span<const std::array<float, 2>>(input));
+    {
+        g_cache::Hdf5Store store(file.path);
+        EXPECT_FALSE(store.Load(key));
+        store.Save(key, hull);
+    }
+    g_cache::Hdf5Store reopened(file.path);
+    EXPECT_EQ(reopened.Load(key), hull) << "Results should persist across stores on the same file";
+}
+
+TEST(Hdf5StoreTest, SecondSaveKeepsFirst) {
+    const TempFile file("cppgeometry_store_resave.h5");
+    g_cache::Hdf5Store store(file.path);
+    const g_cache::CacheKey key {1, 2, 3};
+    store.Save(key, {{1, 1}});
+    store.Save(key, {{2, 2}});
+    EXPECT_EQ(store.Load(key), PointList({{1, 1}}));
+}
+
+TEST(Hdf5StoreTest, MismatchedKeyMisses) {
+    const TempFile file("cppgeometry_store_mismatch.h5");
+    g_cache::Hdf5Store store(file.path);
+    store.Save({1, 2, 3}, {{1, 1}});
+    EXPECT_FALSE(store.Load({1, 2, 4})) << "Same hashes over a different input size should not hit";
+    EXPECT_FALSE(store.Load({1, 5, 3})) << "A different check hash should not hit";
+}
+
+TEST(Hdf5StoreTest, UnreadablePathThrows) {
+    EXPECT_ANY_THROW(g_cache::Hdf5Store("/nonexistent/dir/cache.h5"));
+}
@@ -0,0 +1,135 @@
+#include "gtest/gtest.h"
+#include "../inc/alg/ConvexHull.hpp"
+#include "../inc/ipc/PointRing.hpp"
+#include "TestData.hpp"
+
+#include <thread>
+
+namespace g_alg = geom::alg;
+namespace g_ipc = geom::ipc;
+namespace g_math = geom::math;
+namespace g_test = geom::test;
+
+namespace {
+    // Long enough for a loaded CI machine, short enough that a stalled producer fails the test
+    constexpr std::chrono::seconds kIdle {10};
+
+    // Unique per process so parallel test runs do not collide
+    std::string Name(const std::string_view test) {
+        return "/cppgeometry_" + std::string(test) + "_" + std::to_string(getpid());
+    }
+
+    g_math::Point2f Nth(const size_t i) {
+        return {static_cast<float>(i % 1000), static_cast<float>(i / 1000)};
+    }
+} // namespace
+
+TEST(PointRingTest, ReserveCommitPeekRelease) {
+    auto consumer = g_ipc::PointRing::Create(Name("basic"), 8);
+    auto producer = g_ipc::PointRing::Open(Name("basic"));
+    EXPECT_TRUE(consumer.Peek().empty());
+
+    auto slots = producer.Reserve(5);
+    ASSERT_EQ(slots.size(), 5);
+    for (size_t i = 0; i < slots.size(); i++) slots[i] = Nth(i);
+    EXPECT_TRUE(consumer.Peek().empty()) << "Points are invisible until committed";
+    producer.Commit(5);
+
+    const auto points = consumer.Peek();
+    ASSERT_EQ(points.size(), 5);
+    EXPECT_EQ(points[4], Nth(4)) << "Points written through one mapping should be read through the other";
+    consumer.Release(5);
+
+    EXPECT_EQ(producer.Reserve().size(), 3) << "Reserve should stop at the end of the buffer";
+    EXPECT_EQ(consumer.Size(), 0);
+}
+
+TEST(PointRingTest, FullRingAppliesBackpressure) {
+    auto consumer = g_ipc::PointRing::Create(Name("full"), 4);
+    auto producer = g_ipc::PointRing::Open(Name("full"));
+    const std::vector<g_math::Point2f> points {Nth(0), Nth(1), Nth(2), Nth(3), Nth(4), Nth(5)};
+
+    EXPECT_EQ(producer.TryWrite(points), 4);
+    EXPECT_TRUE(producer.Reserve().empty());
+    EXPECT_EQ(consumer.Consume([](auto) {}, 3), 3);
+    EXPECT_EQ(producer.TryWrite(std::span(points).subspan(4)), 2) << "Writes should wrap around";
+
+    std::vector<g_math::Point2f> read;
+    EXPECT_EQ(consumer.Consume([&read](const auto span) { read.insert(read.end(), span.begin(), span.end()); }), 3);
+    EXPECT_EQ(read, std::vector<g_math::Point2f>({Nth(3), Nth(4), Nth(5)}));
+}
+
+TEST(PointRingTest, StreamsInOrderAcrossThreads) {
+    constexpr size_t kPoints = 1000000;
+    auto consumer = g_ipc::PointRing::Create(Name("stream"), 1 << 10);
+    std::thread thread([] {
+        auto producer = g_ipc::PointRing::Open(Name("stream"));
+        g_ipc::Produce(producer, kPoints, 300, [](const std::span<g_math::Point2f> slots, const size_t first) {
+            for (size_t i = 0; i < slots.size(); i++) slots[i] = Nth(first + i);
+        });
+    });
+
+    size_t next = 0;
+    bool ordered = true;
+    const bool finished = g_ipc::Drain(consumer, [&](const std::span<const g_math::Point2f> points) {
+        for (const auto& p : points) ordered &= p == Nth(next++);
+    }, kIdle);
+    thread.join();
+    ASSERT_TRUE(finished) << "The producer stalled";
+    EXPECT_EQ(next, kPoints);
+    EXPECT_TRUE(ordered);
+}
+
+TEST(PointRingTest, IncrementalHullMatchesBatchHull) {
+    constexpr size_t kPoints = 200000;
+    const auto all = g_test::NormalPoints(kPoints, 11);
+
+    auto consumer = g_ipc::PointRing::Create(Name("hull"), 1 << 12);
+    std::thread thread([&all] {
+        auto producer = g_ipc::PointRing::Open(Name("hull"));
+        g_ipc::Produce(producer, all.size(), 1000, [&all](const std::span<g_math::Point2f> slots, const size_t first) {
+            std::copy_n(all.begin() + first, slots.size(), slots.begin());
+        });
+    });
+
+    g_alg::IncrementalHull hull;
+    const bool finished = g_ipc::Drain(consumer, [&hull](const auto points) { hull.Add(points); }, kIdle);
+    thread.join();
+    ASSERT_TRUE(finished) << "The producer stalled";
+
+    EXPECT_EQ(hull.Count(), kPoints);
+    EXPECT_EQ(hull.Hull(), g_alg::ConvexHull2D(all));
+}
+
+TEST(PointRingTest, DrainGivesUpOnSilentProducer) {
+    auto consumer = g_ipc::PointRing::Create(Name("silent"), 4);
+    auto producer = g_ipc::PointRing::Open(Name("silent"));
+    const std::vector<g_math::Point2f> points {Nth(0), Nth(1)};
+    producer.Write(points);
+
+    size_t read = 0;
+    EXPECT_FALSE(g_ipc::Drain(consumer, [&read](const auto span) { read += span.size(); }, std::chrono::milliseconds(50)))
+        << "A producer that never closes should time out";
+    EXPECT_EQ(read, 2);
+
+    producer.Close();
+    EXPECT_TRUE(g_ipc::Drain(consumer, [](auto) {}, std::chrono::milliseconds(50)));
+}
+
+TEST(PointRingTest, ReclaimsStaleRing) {
+    const auto name = Name("stale");
+    // Stands in for a consumer that crashed without unlinking its ring
+    auto stale = g_ipc::SharedMemory::Create(name, g_ipc::PointRing::BytesFor(4));
+    EXPECT_THROW(g_ipc::PointRing::Create(name, 4), std::runtime_error);
+
+    auto consumer = g_ipc::PointRing::Create(name, 4, true);
+    auto producer = g_ipc::PointRing::Open(name);
+    EXPECT_EQ(producer.Capacity(), 4) << "The producer should find the new ring, not the stale segment";
+}
+
+TEST(PointRingTest, RejectsBadRings) {
+    EXPECT_THROW(g_ipc::PointRing::Create(Name("bad"), 12), std::runtime_error);
+    EXPECT_THROW(g_ipc::PointRing::Open(Name("missing")), std::runtime_error);
+    const auto ring = g_ipc::PointRing::Create(Name("taken"), 4);
+    EXPECT_THROW(g_ipc::PointRing::Create(Name("taken"), 4), std::runtime_error);
+}
@@ -0,0 +1,107 @@
+#include "gtest/gtest.h"
+#include "../inc/alg/PolygonClip.hpp"
+#include "TestData.hpp"
+
+namespace g_alg = geom::alg;
+namespace g_exec = geom::exec;
+namespace g_math = geom::math;
+namespace g_test = geom::test;
+
+class PolygonClipFixture : public ::testing::Test {
+    public:
+        g_alg::Polygon unit_square {{0.0, 0.0}, {1.0, 0.0}, {1.0, 1.0}, {0.0, 1.0}};
+        g_alg::Polygon shifted_square {{0.5, 0.5}, {1.5, 0.5}, {1.5, 1.5}, {0.5, 1.5}};
+
+        static float Area(const std::vector<g_alg::Polygon>& polygons) {
+            float area = 0;
+            for (const auto& polygon : polygons) area += g_alg::SignedArea2(polygon) / 2;
+            return area;
+        }
+};
+
+TEST_F(PolygonClipFixture, ConvexClipOverlap) {
+    const auto got = g_alg::ClipConvex(shifted_square, unit_square);
+    EXPECT_FLOAT_EQ(g_alg::SignedArea2(got) / 2, 0.25) << "Overlap of the squares should have area 0.25";
+}
+
+TEST_F(PolygonClipFixture, ConvexClipInsideAndOutside) {
+    const g_alg::Polygon inside {{0.2, 0.2}, {0.4, 0.2}, {0.3, 0.4}};
+    const g_alg::Polygon outside {{2.0, 2.0}, {3.0, 2.0}, {3.0, 3.0}};
+    EXPECT_EQ(g_alg::ClipConvex(inside, unit_square).size(), 3) << "A polygon inside the window should be unchanged";
+    EXPECT_TRUE(g_alg::ClipConvex(outside, unit_square).empty()) << "A polygon outside the window should vanish";
+}
+
+TEST_F(PolygonClipFixture, ConvexClipAcceptsClockwiseWindow) {
+    g_alg::Polygon window = unit_square;
+    std::ranges::reverse(window);
+    EXPECT_FLOAT_EQ(g_alg::SignedArea2(g_alg::ClipConvex(shifted_square, window)) / 2, 0.25);
+}
+
+TEST_F(PolygonClipFixture, BatchMatchesSingle) {
+    std::vector<g_alg::Polygon> polygons;
+    for (const auto& c : g_test::RandomPoints(5000, 17, -0.5, 1.5)) {
+        polygons.push_back({c, c + g_math::Vector2f(0.3, 0.0), c + g_math::Vector2f(0.1, 0.2)});
+    }
+    g_exec::ThreadPool pool(g_exec::PoolConfig {4, {}});
+    const auto got = g_alg::ClipConvex(g_exec::par.On(pool), polygons, unit_square);
+    ASSERT_EQ(got.size(), polygons.size());
+    for (size_t i = 0; i < polygons.size(); i++) {
+        const auto expected = g_alg::ClipConvex(polygons[i], unit_square);
+        EXPECT_EQ(got[i], expected) << "Polygon " << i << " clipped differently";
+    }
+}
+
+TEST_F(PolygonClipFixture, BooleanOperationsOfOverlappingSquares) {
+    EXPECT_NEAR(Area(g_alg::PolygonBoolean(unit_square, shifted_square, g_alg::BooleanOperation::INTERSECTION)), 0.25, 1e-5);
+    EXPECT_NEAR(Area(g_alg::PolygonBoolean(unit_square, shifted_square, g_alg::BooleanOperation::UNION)), 1.75, 1e-5);
+    EXPECT_NEAR(Area(g_alg::PolygonBoolean(unit_square, shifted_square, g_alg::BooleanOperation::DIFFERENCE)), 0.75, 1e-5);
+}
+
+TEST_F(PolygonClipFixture, BooleanOfConcavePolygon) {
+    // U shape whose arms both cross a horizontal bar, so the intersection has two pieces
+    const g_alg::Polygon u_shape {{0.0, 0.0}, {3.0, 0.0}, {3.0, 3.0}, {2.0, 3.0}, {2.0, 1.0}, {1.0, 1.0}, {1.0, 3.0}, {0.0, 3.0}};
+    const g_alg::Polygon bar {{-1.0, 2.0}, {4.0, 2.0}, {4.0, 2.5}, {-1.0, 2.5}};
+    const auto got = g_alg::PolygonBoolean(u_shape, bar, g_alg::BooleanOperation::INTERSECTION);
+    EXPECT_EQ(got.size(), 2) << "Bar should cut both arms of the U";
+    EXPECT_NEAR(Area(got), 1.0, 1e-5);
+    EXPECT_NEAR(Area(g_alg::PolygonBoolean(u_shape, bar, g_alg::BooleanOperation::UNION)), 7.0 + 1.5, 1e-5);
+}
+
+TEST_F(PolygonClipFixture, BooleanOfNestedPolygons) {
+    const g_alg::Polygon inner {{0.25, 0.25}, {0.75, 0.25}, {0.75, 0.75}, {0.25, 0.75}};
+    EXPECT_NEAR(Area(g_alg::PolygonBoolean(unit_square, inner, g_alg::BooleanOperation::INTERSECTION)), 0.25, 1e-6);
+    EXPECT_NEAR(Area(g_alg::PolygonBoolean(unit_square, inner, g_alg::BooleanOperation::UNION)), 1.0, 1e-6);
+    const auto hole = g_alg::PolygonBoolean(unit_square, inner, g_alg::BooleanOperation::DIFFERENCE);
+    ASSERT_EQ(hole.size(), 2);
+    EXPECT_LT(g_alg::SignedArea2(hole[1]), 0) << "Hole should be clockwise";
+    EXPECT_NEAR(Area(hole), 0.75, 1e-6);
+}
+
+TEST_F(PolygonClipFixture, BooleanWithSharedVertexIsPerturbed) {
+    const g_alg::Polygon touching {{1.0, 1.0}, {2.0, 1.0}, {2.0, 2.0}, {0.5, 2.0}};
+    const auto got = g_alg::PolygonBoolean(unit_square, touching, g_alg::BooleanOperation::UNION);
+    EXPECT_NEAR(Area(got), 1.0 + 1.25, 1e-3);
+}
+
+TEST_F(PolygonClipFixture, BooleanIsScaleInvariant) {
+    // Tolerances follow the input, so tiny, huge and far-off polygons behave like unit ones
+    for (const auto& [scale, origin] : {std::pair {2e-3f, 0.0f}, std::pair {2e3f, 0.0f}, std::pair {10.0f, 1e4f}}) {
+        const auto transform = [scale, origin](g_alg::Polygon polygon) {
+            for (auto& p : polygon) p = {origin + p.x() * scale, origin + p.y() * scale};
+            return polygon;
+        };
+        // Area in unit-square units, measured back at the origin where float area is accurate
+        const auto area = [scale, origin](std::vector<g_alg::Polygon> polygons) {
+            for (auto& polygon : polygons)
+                for (auto& p : polygon) p = {(p.x() - origin) / scale, (p.y() - origin) / scale};
+            return Area(polygons);
+        };
+        const auto a = transform(unit_square), b = transform(shifted_square);
+        EXPECT_NEAR(area(g_alg::PolygonBoolean(a, b, g_alg::BooleanOperation::INTERSECTION)), 0.25, 1e-4) << scale;
+        EXPECT_NEAR(area(g_alg::PolygonBoolean(a, b, g_alg::BooleanOperation::UNION)), 1.75, 1e-4) << scale;
+        EXPECT_NEAR(area(g_alg::PolygonBoolean(a, b, g_alg::BooleanOperation::DIFFERENCE)), 0.75, 1e-4) << scale;
+
+        const auto touching = transform({{1.0, 1.0}, {2.0, 1.0}, {2.0, 2.0}, {0.5, 2.0}});
+        EXPECT_NEAR(area(g_alg::PolygonBoolean(a, touching, g_alg::BooleanOperation::UNION)), 2.25, 1e-3) << scale;
+    }
+}
@@ -0,0 +1,126 @@
+#include "gtest/gtest.h"
+#include "../inc/alg/ConvexHull.hpp"
+#include "../inc/alg/SegmentIntersection.hpp"
+#include "../inc/math/GeomUtils.hpp"
+#include "../inc/math/Line.hpp"
+#include "TestData.hpp"
+
+namespace g_alg = geom::alg;
+namespace g_exec = geom::exec;
+namespace g_math = geom::math;
+namespace g_test = geom::test;
+
+// The supported precisions: float, double, and float storage with double predicates. Explicit
+// instantiation compiles each in full even where no test below happens to call it.
+namespace geom {
+    template std::vector<math::Point2f> alg::ConvexHull2D<void, float>(const std::vector<math::Point2f>&);
+    template std::vector<math::Point2d> alg::ConvexHull2D<void, double>(const std::vector<math::Point2d>&);
+    template std::vector<math::Point2f> alg::ConvexHull2D<double, float>(const std::vector<math::Point2f>&);
+    template std::vector<math::Point2d> alg::ConvexHull2D<void, exec::ParallelPolicy, double>(const exec::ParallelPolicy&, const std::vector<math::Point2d>&);
+    template std::vector<math::Point2f> alg::ConvexHull2D<double, exec::ParallelPolicy, float>(const exec::ParallelPolicy&, const std::vector<math::Point2f>&);
+    template math::Orientation math::Orientation2d<void, double>(const math::Point2d&, const math::Point2d&, const math::Point2d&);
+    template math::Orientation math::Orientation2d<double, float>(const math::Point2f&, const math::Point2f&, const math::Point2f&);
+    template void math::LexicographicOrder<double>(std::vector<math::Point2d>&);
+    template math::Point2d math::GetIntersection<void, double>(const math::Line<double, 2>&, const math::Line<double, 2>&);
+    template math::Point2f math::GetIntersection<double, float>(const math::Line<float, 2>&, const math::Line<float, 2>&);
+    template std::vector<math::Point2d> alg::SegmentIntersections<void, double>(const std::vector<math::Line<double, 2>>&);
+    template std::vector<math::Point2f> alg::SegmentIntersections<double, float>(const std::vector<math::Line<float, 2>>&);
+} // namespace geom
+
+namespace {
+    // A 10 m square of survey points around a UTM-sized origin, with interior points every 0.5 m
+    std::vector<g_math::Point2d> Georeferenced() {
+        constexpr double kEast = 512345.0, kNorth = 5412345.0;
+        std::vector<g_math::Point2d> points;
+        for (int i = 0; i <= 20; i++) {
+            for (int j = 0; j <= 20; j++) points.emplace_back(kEast + 0.5 * i, kNorth + 0.5 * j);
+        }
+        return points;
+    }
+} // namespace
+
+TEST(PrecisionTest, DoubleHullOfGeoreferencedPoints) {
+    const auto hull = g_alg::ConvexHull2D(Georeferenced());
+    ASSERT_EQ(hull.size(), 5) << "Only the corners should remain, closed";
+    EXPECT_DOUBLE_EQ(hull[0].x(), 512345.0);
+    EXPECT_DOUBLE_EQ(hull[0].y(), 5412345.0);
+    EXPECT_EQ(hull.front(), hull.back());
+    for (const auto& p : hull) {
+        EXPECT_TRUE(p.x() == 512345.0 || p.x() == 512355.0) << p;
+        EXPECT_TRUE(p.y() == 5412345.0 || p.y() == 5412355.0) << p;
+    }
+    EXPECT_EQ(g_alg::ConvexHull2D(g_exec::par, Georeferenced()), hull);
+}
+
+TEST(PrecisionTest, MixedPrecisionResolvesThinTurns) {
+    const g_math::Point2f a {0, 0}, b {1, 0}, c {0.5, 1e-5};
+    EXPECT_EQ(g_math::Orientation2d(a, b, c), g_math::Orientation::IN_INTERVAL) << "float snaps this turn to collinear";
+    EXPECT_EQ(g_math::Orientation2d<double>(a, b, c), g_math::Orientation::POSITIVE);
+    EXPECT_EQ(g_math::Orientation2d<double>(b, a, c), g_math::Orientation::NEGATIVE);
+}
+
+TEST(PrecisionTest, MixedHullKeepsThinVertices) {
+    const std::vector<g_math::Point2f> points {{0, 0}, {0.5, -1e-5}, {1, 0}, {1, 1}, {0, 1}};
+    EXPECT_EQ(g_alg::ConvexHull2D(points).size(), 5) << "float drops the shallow vertex";
+    const auto mixed = g_alg::ConvexHull2D<double>(points);
+    EXPECT_EQ(mixed.size(), 6);
+    EXPECT_EQ(g_alg::ConvexHull2D<double>(g_exec::par, points), mixed);
+}
+
+TEST(PrecisionTest, MixedHullRefinesFloatHull) {
+    const auto points = g_test::RandomPoints(10000, 9);
+    const auto single = g_alg::ConvexHull2D(points);
+    const auto mixed = g_alg::ConvexHull2D<double>(points);
+    // Double predicates can only keep vertices that float judged collinear, never drop others
+    EXPECT_GE(mixed.size(), single.size());
+    for (const auto& p : single) EXPECT_NE(std::ranges::find(mixed, p), mixed.end()) << p;
+}
+
+TEST(PrecisionTest, DoubleIntersectionsOfGeoreferencedSegments) {
+    constexpr double kEast = 512345.0, kNorth = 5412345.0;
+    const std::vector<g_math::Line<double, 2>> lines {
+        {{kEast, kNorth}, {kEast + 1, kNorth + 1}},
+        {{kEast, kNorth + 1}, {kEast + 1, kNorth}},
+    };
+    const auto point = g_math::GetIntersection(lines[0], lines[1]);
+    EXPECT_NEAR(point.x(), kEast + 0.5, 1e-9);
+    EXPECT_NEAR(point.y(), kNorth + 0.5, 1e-9);
+
+    const auto crossings = g_alg::SegmentIntersections(lines);
+    ASSERT_EQ(crossings.size(), 1);
+    EXPECT_NEAR(crossings[0].x(), kEast + 0.5, 1e-9);
+    EXPECT_NEAR(crossings[0].y(), kNorth + 0.5, 1e-9);
+}
+
+TEST(PrecisionTest, MixedIntersectionOfNearlyParallelSegments) {
+    // Two long segments a few 1e-5 from parallel, crossing near (1040, 1040). Their directions
+    // round to exactly parallel in float, so a float cross product takes them for collinear.
+    const std::vector<g_math::Line<float, 2>> lines {
+        {{0.530872881f, 0.530838966f}, {1044.05261f, 1044.05261f}},
+        {{1.26712835f, 1.26712382f}, {1069.79895f, 1069.79895f}},
+    };
+    const auto expected = g_math::GetIntersection<double>(lines[0], lines[1]);
+    const auto crossings = g_alg::SegmentIntersections<double>(lines);
+    ASSERT_EQ(crossings.size(), 1);
+    EXPECT_NEAR(crossings[0].x(), expected.x(), 1e-2) << "The crossing should not fall back to an endpoint";
+    EXPECT_NEAR(crossings[0].y(), expected.y(), 1e-2);
+}
+
+TEST(PrecisionTest, EvaluationIsAtLeastWide) {
+    static_assert(g_math::EvaluatesExactly<void, float> && g_math::EvaluatesExactly<double, float>);
+    static_assert(!g_math::EvaluatesExactly<float, double>, "Evaluating double coordinates in float loses precision");
+    static_assert(!g_math::EvaluatesExactly<int64_t, float>, "Floating coordinates need floating evaluation");
+    static_assert(!g_math::EvaluatesExactly<double, int16_t>, "Integer coordinates need exact evaluation");
+    static_assert(g_math::EvaluatesExactly<int64_t, int16_t> && !g_math::EvaluatesExactly<int32_t, int16_t>);
+    static_assert(g_math::EvaluationType<int64_t> && !g_math::EvaluationType<uint64_t>);
+#if defined(__SIZEOF_INT128__)
+    static_assert(g_math::EvaluationType<g_math::Wide<int32_t>>);
+    static_assert(g_math::EvaluatesExactly<g_math::Wide<int32_t>, int16_t> && !g_math::EvaluatesExactly<int64_t, int32_t>);
+#endif
+    SUCCEED();
+}
+
+TEST(PrecisionTest, DoubleNorm) {
+    const g_math::Vector2d v {1e8, 1};
+    EXPECT_DOUBLE_EQ(v.Norm(), std::sqrt(1e16 + 1.0)) << "Double lengths should not be rounded to float";
+}
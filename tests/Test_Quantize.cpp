@@ -0,0 +1,74 @@
+#include "gtest/gtest.h"
+#include "../inc/alg/ConvexHull.hpp"
+#include "../inc/math/Line.hpp"
+#include "../inc/math/Quantize.hpp"
+
+#include <random>
+
+namespace g_alg = geom::alg;
+namespace g_math = geom::math;
+
+TEST(QuantizeTest, RoundTripWithinOneStep) {
+    const std::vector<g_math::Point2f> points {{-3.0, 1.0}, {5.0, 2.5}, {0.25, -4.0}, {1.0, 1.0}};
+    const g_math::Quantizer<int32_t> quantizer(points);
+    const float step = 1 / quantizer.GetScale();
+    for (const auto& p : points) {
+        const auto got = quantizer.Dequantize(quantizer.Quantize(p));
+        EXPECT_NEAR(got.x(), p.x(), step) << "Round trip of " << p << " gave " << got;
+        EXPECT_NEAR(got.y(), p.y(), step) << "Round trip of " << p << " gave " << got;
+    }
+}
+
+TEST(QuantizeTest, ExtremesStayInRange) {
+    const std::vector<g_math::Point2f> points {{0.0, 0.0}, {1.0, 1.0}};
+    const g_math::Quantizer<int16_t> quantizer(points);
+    const auto got = quantizer.Quantize(points);
+    EXPECT_EQ(got[0], g_math::Point2s(-32767, -32767)) << "Minimum corner should map to the grid minimum but got " << got[0];
+    EXPECT_EQ(got[1], g_math::Point2s(32767, 32767)) << "Maximum corner should map to the grid maximum but got " << got[1];
+}
+
+TEST(QuantizeTest, IntegerOrientationIsExact) {
+    // Differences overflow int32 and the cross product overflows int64
+    const g_math::Point2i a(-2000000000, -2000000000);
+    const g_math::Point2i b(2000000000, 2000000000);
+    const g_math::Point2i on(1999999999, 1999999999);
+    const g_math::Point2i left(1999999999, 2000000000);
+    EXPECT_EQ(g_math::Orientation2d(a, b, on), g_math::Orientation::IN_INTERVAL);
+    EXPECT_EQ(g_math::Orientation2d(a, b, left), g_math::Orientation::POSITIVE);
+    EXPECT_EQ(g_math::Orientation2d(b, a, left), g_math::Orientation::NEGATIVE);
+}
+
+TEST(QuantizeTest, IntegerSegmentsIntersect) {
+    const g_math::Line<int32_t, 2> a({0, 0}, {10, 10});
+    const g_math::Line<int32_t, 2> b({0, 10}, {10, 0});
+    const g_math::Line<int32_t, 2> c({0, 1}, {10, 11});
+    EXPECT_TRUE(a.Intersects(b));
+    EXPECT_FALSE(a.Intersects(c));
+}
+
+TEST(QuantizeTest, QuantizedHullContainsFloatHull) {
+    std::mt19937 rng(3);
+    std::uniform_int_distribution<int> dist(0, 1000);
+    std::vector<g_math::Point2f> points;
+    for (size_t i = 0; i < 2000; i++) points.emplace_back(dist(rng) / 1000.0f, dist(rng) / 1000.0f);
+
+    const g_math::Quantizer<int32_t> quantizer(points);
+    const auto got = g_alg::ConvexHull2D(quantizer.Quantize(points));
+    // The exact hull may keep nearly collinear vertices that the float tolerance drops
+    for (const auto& p : quantizer.Quantize(g_alg::ConvexHull2D(points))) {
+        EXPECT_TRUE(std::ranges::find(got, p) != got.end()) << p << " should be a vertex of the quantized hull";
+    }
+    for (size_t i = 0; i + 2 < got.size(); i++) {
+        EXPECT_EQ(g_math::Orientation2d(got[i], got[i + 1], got[i + 2]), g_math::Orientation::POSITIVE);
+    }
+}
+
+TEST(QuantizeTest, OnlyExactIntegersAreCoordinates) {
+    static_assert(g_math::Arithmetic<int16_t> && g_math::Arithmetic<float> && g_math::Arithmetic<double>);
+    static_assert(!g_math::Arithmetic<int64_t>, "int64 products overflow every wide type");
+    static_assert(!g_math::Arithmetic<uint8_t> && !g_math::Arithmetic<bool>);
+#if defined(__SIZEOF_INT128__)
+    static_assert(g_math::Arithmetic<int32_t>);
+#endif
+    SUCCEED();
+}
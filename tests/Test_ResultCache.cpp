@@ -0,0 +1,110 @@
+#include "gtest/gtest.h"
+#include "../inc/cache/ResultCache.hpp"
+
+#include <map>
+#include <string>
+#include <vector>
+
+namespace g_cache = geom::cache;
+
+namespace {
+    // Stands in for Hdf5Store so the second tier can be tested without touching disk
+    class MemoryStore : public g_cache::CacheStore<std::string> {
+    public:
+        std::map<g_cache::CacheKey, std::string> saved;
+
+        std::optional<std::string> Load(const g_cache::CacheKey& key) override {
+            if (const auto it = saved.find(key); it != saved.end()) return it->second;
+            return std::nullopt;
+        }
+
+        void Save(const g_cache::CacheKey& key, const std::string& value) override {
+            saved[key] = value;
+        }
+    };
+
+    g_cache::CacheKey Key(const uint64_t n) {
+        return {n, ~n, 8};
+    }
+}
+
+TEST(HashTest, StableAndSensitive) {
+    const std::vector<float> data {0.1f, 0.2f, 0.3f, 0.4f, 0.5f};
+    std::vector<float> changed = data;
+    changed.back() = 0.50001f;
+
+    const auto key = g_cache::ResultKey("hull", std::span<const float>(data));
+    EXPECT_EQ(key, g_cache::ResultKey("hull", std::span<const float>(data)));
+    EXPECT_NE(key, g_cache::ResultKey("hull", std::span<const float>(changed))) << "Any change to the input should change the key";
+    EXPECT_NE(key, g_cache::ResultKey("diameter", std::span<const float>(data))) << "Algorithm should be part of the key";
+    EXPECT_NE(key, g_cache::ResultKey("hull", std::span<const float>(data).first(4))) << "Length should be part of the key";
+    EXPECT_NE(key.hash, key.check);
+    EXPECT_EQ(key.size, data.size() * sizeof(float));
+}
+
+TEST(HashTest, EmptyInput) {
+    EXPECT_EQ(g_cache::HashBytes(nullptr, 0), g_cache::HashBytes(nullptr, 0));
+    EXPECT_NE(g_cache::HashBytes(nullptr, 0, 1), g_cache::HashBytes(nullptr, 0, 2));
+    const auto key = g_cache::ResultKey("hull", std::span<const float>());
+    EXPECT_EQ(key.size, 0);
+}
+
+TEST(ResultCacheTest, EvictsLeastRecentlyUsed) {
+    g_cache::ResultCache<std::string> cache(2);
+    cache.Put(Key(1), "one");
+    cache.Put(Key(2), "two");
+    EXPECT_EQ(cache.Find(Key(1)), "one");
+    cache.Put(Key(3), "three");
+
+    EXPECT_EQ(cache.Size(), 2);
+    EXPECT_FALSE(cache.Find(Key(2))) << "Key 2 was least recently used";
+    EXPECT_EQ(cache.Find(Key(1)), "one");
+    EXPECT_EQ(cache.Find(Key(3)), "three");
+
+    const auto stats = cache.Stats();
+    EXPECT_EQ(stats.hits, 3);
+    EXPECT_EQ(stats.misses, 1);
+    EXPECT_EQ(stats.evictions, 1);
+    EXPECT_DOUBLE_EQ(stats.HitRate(), 0.75);
+}
+
+TEST(ResultCacheTest, GetOrComputeRunsOnce) {
+    g_cache::ResultCache<std::string> cache(4);
+    int calls = 0;
+    auto compute = [&calls] {
+        calls++;
+        return std::string("hull");
+    };
+    EXPECT_EQ(cache.GetOrCompute(Key(7), compute), "hull");
+    EXPECT_EQ(cache.GetOrCompute(Key(7), compute), "hull");
+    EXPECT_EQ(calls, 1);
+}
+
+TEST(ResultCacheTest, FallsBackToStore) {
+    const auto store = std::make_shared<MemoryStore>();
+    {
+        g_cache::ResultCache<std::string> cache(1, store);
+        cache.Put(Key(1), "one");
+        cache.Put(Key(2), "two");
+    }
+    EXPECT_EQ(store->saved.size(), 2) << "Every result should be written through to the store";
+
+    g_cache::ResultCache<std::string> cache(1, store);
+    EXPECT_EQ(cache.Find(Key(1)), "one");
+    EXPECT_EQ(cache.Find(Key(1)), "one");
+    const auto stats = cache.Stats();
+    EXPECT_EQ(stats.disk_hits, 1);
+    EXPECT_EQ(stats.hits, 1) << "A disk hit should be promoted to memory";
+}
+
+TEST(ResultCacheTest, HashCollisionMisses) {
+    g_cache::ResultCache<std::string> cache(4);
+    cache.Put({1, 2, 8}, "one");
+    EXPECT_FALSE(cache.Find({1, 3, 8})) << "Equal hashes with a different check should not hit";
+    EXPECT_FALSE(cache.Find({1, 2, 16})) << "Equal hashes over a different input size should not hit";
+    EXPECT_EQ(cache.Find({1, 2, 8}), "one");
+}
+
+TEST(ResultCacheTest, RejectsZeroCapacity) {
+    EXPECT_THROW(g_cache::ResultCache<std::string>(0), std::runtime_error);
+}
@@ -0,0 +1,66 @@
+#include "gtest/gtest.h"
+#include "../inc/alg/ConvexHull.hpp"
+#include "../inc/alg/RotatingCalipers.hpp"
+#include "TestData.hpp"
+
+namespace g_alg = geom::alg;
+namespace g_math = geom::math;
+namespace g_test = geom::test;
+
+class RotatingCalipersFixture : public ::testing::Test {
+    public:
+        // Unit square as produced by ConvexHull2D, including the closing vertex
+        std::vector<g_math::Point2f> square = g_alg::ConvexHull2D({
+            {0.0, 0.0}, {1.0, 0.0}, {1.0, 1.0}, {0.0, 1.0}, {0.5, 0.5}
+        });
+};
+
+TEST_F(RotatingCalipersFixture, DiameterOfSquare) {
+    const auto got = g_alg::Diameter(square);
+    EXPECT_FLOAT_EQ(got.distance, std::sqrt(2.0f)) << "Diameter of unit square should be sqrt(2) but got " << got.distance;
+}
+
+TEST_F(RotatingCalipersFixture, DiameterMatchesBruteForce) {
+    const auto points = g_test::RandomPoints(500, 42);
+    float expected = 0;
+    for (const auto& a : points)
+        for (const auto& b : points) expected = std::max(expected, (a - b).Norm());
+
+    const auto got = g_alg::Diameter(g_alg::ConvexHull2D(points));
+    EXPECT_NEAR(got.distance, expected, 1e-5) << "Diameter should be " << expected << " but got " << got.distance;
+    EXPECT_NEAR((got.first - got.second).Norm(), got.distance, 1e-5);
+}
+
+TEST_F(RotatingCalipersFixture, WidthOfSquare) {
+    const float got = g_alg::MinimumWidth(square);
+    EXPECT_FLOAT_EQ(got, 1.0) << "Width of unit square should be 1.0 but got " << got;
+}
+
+TEST_F(RotatingCalipersFixture, WidthOfTriangle) {
+    const auto hull = g_alg::ConvexHull2D({{0.0, 0.0}, {4.0, 0.0}, {2.0, 1.0}});
+    const float got = g_alg::MinimumWidth(hull);
+    EXPECT_FLOAT_EQ(got, 1.0) << "Width of triangle should be its height 1.0 but got " << got;
+}
+
+TEST_F(RotatingCalipersFixture, MinimumAreaRectangleOfRotatedSquare) {
+    const auto hull = g_alg::ConvexHull2D({{1.0, 0.0}, {2.0, 1.0}, {1.0, 2.0}, {0.0, 1.0}});
+    const auto got = g_alg::MinimumAreaRectangle(hull);
+    EXPECT_NEAR(got.area, 2.0, 1e-5) << "Rotated square should have area 2.0 but got " << got.area;
+    for (const auto& corner : got.corners) {
+        EXPECT_TRUE(std::ranges::find(hull, corner) != hull.end()) << corner << " should be a hull vertex";
+    }
+}
+
+TEST_F(RotatingCalipersFixture, RectanglesEncloseHull) {
+    const auto hull = g_alg::ConvexHull2D(g_test::RandomPoints(200, 42));
+    for (const auto& rect : {g_alg::MinimumAreaRectangle(hull), g_alg::MinimumPerimeterRectangle(hull)}) {
+        for (const auto& p : hull) {
+            for (size_t i = 0; i < 4; i++) {
+                const auto edge = rect.corners[(i + 1) % 4] - rect.corners[i];
+                EXPECT_GE(g_math::Cross2D(edge, p - rect.corners[i]), -1e-4) << p << " lies outside the rectangle";
+            }
+        }
+    }
+    EXPECT_LE(g_alg::MinimumAreaRectangle(hull).area, g_alg::MinimumPerimeterRectangle(hull).area + 1e-6);
+    EXPECT_LE(g_alg::MinimumPerimeterRectangle(hull).perimeter, g_alg::MinimumAreaRectangle(hull).perimeter + 1e-6);
+}
@@ -0,0 +1,82 @@
+#include "gtest/gtest.h"
+#include "../inc/viz/Scene.hpp"
+
+#include <algorithm>
+
+namespace g_math = geom::math;
+namespace g_viz = geom::viz;
+
+namespace {
+    // Stands in for HighFive's read_raw on an N x 2 dataset
+    auto Reader(const std::vector<float>& rows) {
+        return [&rows](float* xy) { std::ranges::copy(rows, xy); };
+    }
+} // namespace
+
+TEST(SceneTest, LoadsPointsIntoScreenCoordinates) {
+    g_viz::Scene scene(100, 50);
+    const std::vector<float> rows {0, 0, 1, 1, 0.5, 0.25};
+    scene.LoadPoints(3, Reader(rows));
+
+    const std::vector<g_math::Point2f> expected {{0, 50}, {100, 0}, {50, 37.5}};
+    EXPECT_EQ(scene.Points(), expected) << "y should point down the screen";
+}
+
+TEST(SceneTest, LoadsSegmentsFromRowPairs) {
+    g_viz::Scene scene(10, 10);
+    const std::vector<float> rows {0, 0, 1, 1, 0, 1, 1, 0, 0.5, 0.5};
+    scene.LoadSegments(5, Reader(rows));
+
+    ASSERT_EQ(scene.Segments().size(), 2) << "The odd trailing row should be ignored";
+    EXPECT_EQ(scene.Segments()[0].GetOrigin(), g_math::Point2f(0, 10));
+    EXPECT_EQ(scene.Segments()[0].GetDest(), g_math::Point2f(10, 0));
+    EXPECT_EQ(scene.Segments()[1].GetOrigin(), g_math::Point2f(0, 0));
+    EXPECT_TRUE(scene.Points().empty());
+}
+
+TEST(SceneTest, SkipsZeroLengthSegments) {
+    g_viz::Scene scene(10, 10);
+    const std::vector<float> rows {0, 0, 1, 1, 0.5, 0.5, 0.5, 0.5, 1, 0, 0, 1};
+    EXPECT_EQ(scene.LoadSegments(6, Reader(rows)), 1);
+    EXPECT_EQ(scene.Segments().size(), 2) << "Only the degenerate pair should be dropped";
+}
+
+TEST(SceneTest, FailedLoadLeavesSceneUnchanged) {
+    g_viz::Scene scene(10, 10);
+    const std::vector<float> rows {0.5, 0.5};
+    scene.LoadPoints(1, Reader(rows));
+    EXPECT_THROW(scene.LoadPoints(4, [](float*) { throw std::runtime_error("read failed"); }), std::runtime_error);
+    EXPECT_EQ(scene.Points().size(), 1);
+}
+
+TEST(SceneTest, AppendsAndTracksVersion) {
+    g_viz::Scene scene(10, 10);
+    const std::vector<float> rows {0.1, 0.2};
+    const auto initial = scene.Version();
+    scene.LoadPoints(1, Reader(rows));
+    const std::vector<g_math::Point2f> found {{3, 4}};
+    scene.AddPoints(found);
+
+    ASSERT_EQ(scene.Points().size(), 2);
+    EXPECT_EQ(scene.Points()[0], g_math::Point2f(1, 8));
+    EXPECT_EQ(scene.Points()[1], g_math::Point2f(3, 4)) << "Screen points should be stored as given";
+    EXPECT_EQ(scene.Version(), initial + 2);
+}
+
+TEST(SceneTest, ReloadReusesStorage) {
+    g_viz::Scene scene(10, 10);
+    const std::vector<float> rows(2000, 0.5);
+    scene.LoadPoints(1000, Reader(rows));
+    const auto* storage = scene.Points().data();
+
+    for (int run = 0; run < 3; run++) {
+        scene.Clear();
+        EXPECT_TRUE(scene.Points().empty());
+        scene.LoadPoints(1000, Reader(rows));
+        EXPECT_EQ(scene.Points().data(), storage) << "Reloading the same data should not reallocate";
+    }
+}
+
+TEST(SceneTest, RejectsEmptyScreen) {
+    EXPECT_THROW(g_viz::Scene(0, 10), std::runtime_error);
+}
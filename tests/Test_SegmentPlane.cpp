@@ -0,0 +1,77 @@
+#include "gtest/gtest.h"
+#include "../inc/alg/SegmentPlane.hpp"
+
+#include <random>
+
+namespace g_alg = geom::alg;
+namespace g_exec = geom::exec;
+namespace g_math = geom::math;
+
+class SegmentPlaneFixture : public ::testing::Test {
+    public:
+        // z = 1
+        g_math::Plane layer {g_math::Vector3f {0.0, 0.0, 1.0}, 1.0};
+
+        static std::vector<g_math::Line<float, 3>> RandomSegments(const size_t n, const unsigned seed = 7) {
+            std::mt19937 rng(seed);
+            std::uniform_real_distribution<float> dist(-2.0, 2.0);
+            std::vector<g_math::Line<float, 3>> lines;
+            for (size_t i = 0; i < n; i++) {
+                lines.emplace_back(g_math::Point3f {dist(rng), dist(rng), dist(rng)},
+                                   g_math::Point3f {dist(rng), dist(rng), dist(rng)});
+            }
+            return lines;
+        }
+};
+
+TEST_F(SegmentPlaneFixture, Single) {
+    const g_math::Line<float, 3> crossing({0.0, 0.0, 0.0}, {4.0, 0.0, 4.0});
+    const auto t = g_alg::IntersectPlane(crossing, layer);
+    ASSERT_TRUE(t);
+    EXPECT_FLOAT_EQ(*t, 0.25);
+
+    const g_math::Line<float, 3> below({0.0, 0.0, 0.0}, {1.0, 1.0, 0.5});
+    const g_math::Line<float, 3> in_plane({0.0, 0.0, 1.0}, {1.0, 1.0, 1.0});
+    EXPECT_FALSE(g_alg::IntersectPlane(below, layer));
+    EXPECT_FALSE(g_alg::IntersectPlane(in_plane, layer)) << "A segment in the plane does not cross it";
+}
+
+TEST_F(SegmentPlaneFixture, VertexOnPlaneCountedOnce) {
+    // Two edges of a mesh meeting at a vertex on the plane, one from below and one continuing above
+    const g_math::Line<float, 3> up({0.0, 0.0, 0.0}, {1.0, 0.0, 1.0});
+    const g_math::Line<float, 3> onwards({1.0, 0.0, 1.0}, {2.0, 0.0, 2.0});
+    EXPECT_TRUE(g_alg::IntersectPlane(up, layer));
+    EXPECT_FALSE(g_alg::IntersectPlane(onwards, layer));
+}
+
+TEST_F(SegmentPlaneFixture, BatchMatchesSingle) {
+    const auto lines = RandomSegments(10000);
+    const g_alg::SegmentBatch batch(lines);
+    const auto hits = g_alg::IntersectPlane(batch, layer);
+
+    size_t count = 0;
+    for (size_t i = 0; i < lines.size(); i++) {
+        const auto t = g_alg::IntersectPlane(lines[i], layer);
+        ASSERT_EQ(hits.hit[i] == 1, t.has_value()) << "Segment " << i;
+        if (!t) continue;
+        count++;
+        EXPECT_NEAR(hits.t[i], *t, 1e-5);
+        EXPECT_NEAR(hits.z[i], 1.0, 1e-4) << "Hit points should lie on the plane";
+    }
+    EXPECT_EQ(hits.Count(), count);
+}
+
+TEST_F(SegmentPlaneFixture, ManyPlanesMatchOnePlane) {
+    const g_alg::SegmentBatch batch(RandomSegments(50000));
+    std::vector<g_math::Plane> planes;
+    for (int i = -3; i <= 3; i++) planes.emplace_back(g_math::Vector3f {0.0, 0.0, 1.0}, 0.5f * i);
+
+    g_exec::ThreadPool pool(g_exec::PoolConfig {4, {}});
+    const auto got = g_alg::IntersectPlanes(g_exec::par.On(pool), batch, planes);
+    ASSERT_EQ(got.size(), planes.size());
+    for (size_t p = 0; p < planes.size(); p++) {
+        const auto expected = g_alg::IntersectPlane(batch, planes[p]);
+        EXPECT_EQ(got[p].hit, expected.hit) << "Plane " << p;
+        EXPECT_EQ(got[p].t, expected.t) << "Plane " << p;
+    }
+}
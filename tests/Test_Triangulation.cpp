@@ -0,0 +1,111 @@
+#include "gtest/gtest.h"
+#include "../inc/alg/Triangulation.hpp"
+
+#include <cmath>
+#include <numbers>
+#include <random>
+
+namespace g_alg = geom::alg;
+namespace g_exec = geom::exec;
+namespace g_math = geom::math;
+
+namespace {
+    // Every triangle is counter-clockwise and the triangles tile the polygon exactly
+    void ExpectValid(const g_alg::Polygon& polygon, const std::vector<g_alg::Triangle>& triangles) {
+        ASSERT_EQ(triangles.size(), polygon.size() - 2);
+        double area = 0;
+        for (const auto& t : triangles) {
+            for (const auto i : t) ASSERT_LT(i, polygon.size());
+            const g_alg::Polygon triangle {polygon[t[0]], polygon[t[1]], polygon[t[2]]};
+            const float a = g_alg::SignedArea2(triangle);
+            EXPECT_GE(a, 0) << "Triangle " << t[0] << " " << t[1] << " " << t[2] << " should be counter-clockwise";
+            area += a;
+        }
+        EXPECT_NEAR(area, std::abs(g_alg::SignedArea2(polygon)), 1e-3 * std::abs(g_alg::SignedArea2(polygon)));
+    }
+
+    // Comb with teeth pointing up and down, so it has split and merge vertices
+    g_alg::Polygon Comb(const int teeth) {
+        g_alg::Polygon polygon;
+        for (int i = 0; i < teeth; i++) {
+            polygon.emplace_back(2.0f * i, 0.0f);
+            polygon.emplace_back(2.0f * i + 1, -3.0f);
+        }
+        polygon.emplace_back(2.0f * teeth, 0.0f);
+        polygon.emplace_back(2.0f * teeth, 1.0f);
+        for (int i = teeth; i > 0; i--) {
+            polygon.emplace_back(2.0f * i - 1, 4.0f);
+            polygon.emplace_back(2.0f * i - 2, 1.0f);
+        }
+        return polygon;
+    }
+
+    // Random star-shaped polygon with n vertices around the origin
+    g_alg::Polygon Star(const size_t n, const unsigned seed) {
+        std::mt19937 rng(seed);
+        std::uniform_real_distribution<float> radius(0.2, 1.0);
+        g_alg::Polygon polygon;
+        for (size_t i = 0; i < n; i++) {
+            const float angle = 2 * std::numbers::pi_v<float> * i / n;
+            const float r = radius(rng);
+            polygon.emplace_back(r * std::cos(angle), r * std::sin(angle));
+        }
+        return polygon;
+    }
+
+    g_alg::Polygon Scaled(g_alg::Polygon polygon, const float scale) {
+        for (auto& p : polygon) p = {p.x() * scale, p.y() * scale};
+        return polygon;
+    }
+} // namespace
+
+TEST(TriangulationTest, Square) {
+    const g_alg::Polygon square {{0.0, 0.0}, {1.0, 0.0}, {1.0, 1.0}, {0.0, 1.0}};
+    ExpectValid(square, g_alg::Triangulate(square));
+}
+
+TEST(TriangulationTest, ClockwiseInput) {
+    g_alg::Polygon l_shape {{0.0, 0.0}, {2.0, 0.0}, {2.0, 1.0}, {1.0, 1.0}, {1.0, 2.0}, {0.0, 2.0}};
+    std::ranges::reverse(l_shape);
+    ExpectValid(l_shape, g_alg::Triangulate(l_shape));
+}
+
+TEST(TriangulationTest, SplitAndMergeVertices) {
+    const auto comb = Comb(20);
+    ExpectValid(comb, g_alg::Triangulate(comb));
+}
+
+TEST(TriangulationTest, RandomStarPolygons) {
+    for (unsigned seed = 0; seed < 20; seed++) {
+        const auto star = Star(200, seed);
+        ExpectValid(star, g_alg::Triangulate(star));
+    }
+}
+
+TEST(TriangulationTest, RejectsDegenerateInput) {
+    EXPECT_THROW(g_alg::Triangulate(g_alg::Polygon {{0.0, 0.0}, {1.0, 0.0}}), std::runtime_error);
+}
+
+TEST(TriangulationTest, BatchMatchesSingle) {
+    std::vector<g_alg::Polygon> polygons;
+    for (unsigned seed = 0; seed < 64; seed++) polygons.push_back(seed % 2 ? Star(100, seed) : Comb(seed % 7 + 1));
+
+    g_exec::ThreadPool pool(g_exec::PoolConfig {4, {}});
+    const auto got = g_alg::Triangulate(g_exec::par.On(pool), polygons);
+    ASSERT_EQ(got.size(), polygons.size());
+    for (size_t i = 0; i < polygons.size(); i++) EXPECT_EQ(got[i], g_alg::Triangulate(polygons[i]));
+}
+
+TEST(TriangulationTest, ScaleInvariant) {
+    const g_alg::Polygon u_shape {{0.0, 0.0}, {3.0, 0.0}, {3.0, 3.0}, {2.0, 3.0}, {2.0, 1.0}, {1.0, 1.0}, {1.0, 3.0}, {0.0, 3.0}};
+    g_alg::Polygon n_shape = u_shape;
+    for (auto& p : n_shape) p = {p.x(), 3 - p.y()};
+    std::ranges::reverse(n_shape);
+    for (const float scale : {1e-4f, 1e-3f, 1e3f}) {
+        for (const auto& polygon : {Comb(5), Star(100, 3), u_shape, n_shape}) {
+            const auto scaled = Scaled(polygon, scale);
+            SCOPED_TRACE(testing::Message() << "scale " << scale << ", " << polygon.size() << " vertices");
+            ExpectValid(scaled, g_alg::Triangulate(scaled));
+        }
+    }
+}